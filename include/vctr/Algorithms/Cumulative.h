@@ -0,0 +1,599 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::detail
+{
+
+enum class CumulativeOperation
+{
+    sum,
+    product,
+    max
+};
+
+/** Implements the inclusive prefix scans behind cumulativeSum, cumulativeProduct and cumulativeMax.
+
+    Each result depends on all previous ones, so there is no expression template for them. The SIMD kernels scan a
+    whole register in log2 (numElements) steps of shifting and combining its elements and then combine the result with
+    a broadcast carry register holding the last result of the previous register.
+ */
+template <CumulativeOperation operation, class T>
+struct CumulativeScan
+{
+    static constexpr T identity = operation == CumulativeOperation::sum     ? T (0)
+                                : operation == CumulativeOperation::product ? T (1)
+                                                                            : std::numeric_limits<T>::lowest();
+
+    /** Sources with less elements per thread are not split into blocks. */
+    static constexpr size_t minNumElementsPerThread = size_t (1) << 16;
+
+    /** Block sizes are a multiple of this, so that no two threads write to the same cache line of the destination. */
+    static constexpr size_t blockSizeGranularity = 64;
+
+    template <class SrcType>
+    static constexpr void scan (const SrcType& src, T* dst)
+    {
+        const auto n = src.size();
+
+        if (n == 0)
+            return;
+
+        if (std::is_constant_evaluated())
+        {
+            scanElementWise (src, dst, 0, n, identity);
+            return;
+        }
+
+        scanBlock (src, dst, 0, n, identity, prepareSIMDEvaluation (src));
+    }
+
+    template <class SrcType>
+    static void scan (const SrcType& src, T* dst, ThreadPool& pool)
+    {
+        const auto n = src.size();
+        const auto numBlocks = std::min (pool.getNumThreads(), n / minNumElementsPerThread);
+
+        if (numBlocks < 2)
+            return scan (src, dst);
+
+        scanParallel (src, dst, n, numBlocks, prepareSIMDEvaluation (src), pool);
+    }
+
+private:
+    //==============================================================================
+    VCTR_FORCEDINLINE static constexpr T combine (T a, T b)
+    {
+        if constexpr (operation == CumulativeOperation::sum)
+            return a + b;
+
+        if constexpr (operation == CumulativeOperation::product)
+            return a * b;
+
+        if constexpr (operation == CumulativeOperation::max)
+            return std::max (a, b);
+    }
+
+    static void applyOffset (T* d, size_t len, T offset)
+    {
+        Span<T> block (d, len);
+
+        if constexpr (operation == CumulativeOperation::sum)
+            block += offset;
+
+        if constexpr (operation == CumulativeOperation::product)
+            block *= offset;
+
+        if constexpr (operation == CumulativeOperation::max)
+            block = clampLow (offset) << block;
+    }
+
+    /** Prepares the source for the SIMD kernel that will be used and returns the corresponding instruction set. */
+    template <class SrcType>
+    static CPUInstructionSet prepareSIMDEvaluation (const SrcType& src)
+    {
+        if constexpr (is::realFloatNumber<T> && std::same_as<vctr::ValueType<SrcType>, T>)
+        {
+            if constexpr (has::getNeon<SrcType>)
+            {
+                src.prepareNeonEvaluation();
+                return CPUInstructionSet::neon;
+            }
+
+            if constexpr (has::getAVX512<SrcType>)
+            {
+                if (Config::supportsAVX512)
+                {
+                    prepareAVX512Evaluation (src);
+                    return CPUInstructionSet::avx512;
+                }
+            }
+
+            if constexpr (has::getAVX<SrcType>)
+            {
+                if (Config::supportsAVX)
+                {
+                    prepareAVXEvaluation (src);
+                    return CPUInstructionSet::avx;
+                }
+            }
+
+            if constexpr (has::getSSE<SrcType>)
+            {
+                if (Config::highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+                {
+                    prepareSSEEvaluation (src);
+                    return CPUInstructionSet::sse4_1;
+                }
+            }
+        }
+
+        return CPUInstructionSet::fallback;
+    }
+
+    // The source has to be prepared from functions compiled for the corresponding instruction set
+    template <class SrcType>
+    VCTR_TARGET ("avx512f") static void prepareAVX512Evaluation (const SrcType& src) { src.prepareAVX512Evaluation(); }
+
+    template <class SrcType>
+    VCTR_TARGET ("avx") static void prepareAVXEvaluation (const SrcType& src) { src.prepareAVXEvaluation(); }
+
+    template <class SrcType>
+    VCTR_TARGET ("sse4.1") static void prepareSSEEvaluation (const SrcType& src) { src.prepareSSEEvaluation(); }
+
+    /** Scans the elements in the range [begin, end), starting with carry. The source has to be prepared already. */
+    template <class SrcType>
+    static void scanBlock (const SrcType& src, T* dst, size_t begin, size_t end, T carry, CPUInstructionSet instructionSet)
+    {
+        if constexpr (is::realFloatNumber<T> && std::same_as<vctr::ValueType<SrcType>, T>)
+        {
+            if constexpr (has::getNeon<SrcType>)
+            {
+                if (instructionSet == CPUInstructionSet::neon)
+                    return scanNeon (src, dst, begin, end, carry);
+            }
+
+            if constexpr (has::getAVX512<SrcType>)
+            {
+                if (instructionSet == CPUInstructionSet::avx512)
+                    return scanAVX512 (src, dst, begin, end, carry);
+            }
+
+            if constexpr (has::getAVX<SrcType>)
+            {
+                if (instructionSet == CPUInstructionSet::avx)
+                    return scanAVX (src, dst, begin, end, carry);
+            }
+
+            if constexpr (has::getSSE<SrcType>)
+            {
+                if (instructionSet == CPUInstructionSet::sse4_1)
+                    return scanSSE (src, dst, begin, end, carry);
+            }
+        }
+
+        scanElementWise (src, dst, begin, end, carry);
+    }
+
+    /** Splits the source into one block per thread. In a first pass, all blocks are scanned independently. After
+        combining the last result of each block with the final last result of the previous one, which makes it final as
+        well, a second pass combines the final last result of the previous block into all other results of each block.
+        This needs no memory for the block offsets and no thread reads results that another one writes.
+     */
+    template <class SrcType>
+    static void scanParallel (const SrcType& src, T* dst, size_t n, size_t numBlocks, CPUInstructionSet instructionSet, ThreadPool& pool)
+    {
+        const auto blockSize = nextMultipleOf<blockSizeGranularity> ((n + numBlocks - 1) / numBlocks);
+        numBlocks = (n + blockSize - 1) / blockSize;
+
+        const auto blockBegin = [&] (size_t b) { return b * blockSize; };
+        const auto blockEnd = [&] (size_t b) { return std::min (n, (b + 1) * blockSize); };
+
+        pool.parallelFor (numBlocks, [&] (size_t b) { scanBlock (src, dst, blockBegin (b), blockEnd (b), identity, instructionSet); });
+
+        for (size_t b = 1; b < numBlocks; ++b)
+            dst[blockEnd (b) - 1] = combine (dst[blockEnd (b - 1) - 1], dst[blockEnd (b) - 1]);
+
+        pool.parallelFor (numBlocks - 1, [&] (size_t i)
+        {
+            const auto b = i + 1;
+            applyOffset (dst + blockBegin (b), blockEnd (b) - 1 - blockBegin (b), dst[blockBegin (b) - 1]);
+        });
+    }
+
+    template <class SrcType>
+    static constexpr void scanElementWise (const SrcType& src, T* dst, size_t begin, size_t end, T carry)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            carry = combine (carry, src[i]);
+            dst[i] = carry;
+        }
+    }
+
+    //==============================================================================
+    // Neon Implementation
+    static NeonRegister<T> combine (NeonRegister<T> a, NeonRegister<T> b)
+    requires Config::archARM
+    {
+        if constexpr (operation == CumulativeOperation::sum)
+            return NeonRegister<T>::add (a, b);
+
+        if constexpr (operation == CumulativeOperation::product)
+            return NeonRegister<T>::mul (a, b);
+
+        if constexpr (operation == CumulativeOperation::max)
+            return NeonRegister<T>::max (a, b);
+    }
+
+    template <class SrcType>
+    static void scanNeon (const SrcType& src, T* dst, size_t begin, size_t end, T carry)
+    requires Config::archARM
+    {
+        using R = NeonRegister<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto id = R::broadcast (identity);
+        auto c = R::broadcast (carry);
+
+        size_t i = begin;
+        for (; i + inc <= end; i += inc)
+        {
+            auto x = src.getNeon (i);
+            x = combine (x, R::template shiftUp<1> (x, id));
+
+            if constexpr (inc == 4)
+                x = combine (x, R::template shiftUp<2> (x, id));
+
+            // See scanAVX512 for the carry
+            combine (x, c).store (dst + i);
+            c = combine (c, R::broadcastLast (x));
+        }
+
+        if (i > begin)
+            carry = dst[i - 1];
+
+        scanElementWise (src, dst, i, end, carry);
+    }
+
+    //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static AVX512Register<T> combine (AVX512Register<T> a, AVX512Register<T> b)
+    requires Config::archX64
+    {
+        if constexpr (operation == CumulativeOperation::sum)
+            return AVX512Register<T>::add (a, b);
+
+        if constexpr (operation == CumulativeOperation::product)
+            return AVX512Register<T>::mul (a, b);
+
+        if constexpr (operation == CumulativeOperation::max)
+            return AVX512Register<T>::max (a, b);
+    }
+
+    template <class SrcType>
+    VCTR_TARGET ("avx512f") static void scanAVX512 (const SrcType& src, T* dst, size_t begin, size_t end, T carry)
+    requires Config::archX64
+    {
+        using R = AVX512Register<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto id = R::broadcast (identity);
+        auto c = R::broadcast (carry);
+
+        size_t i = begin;
+        for (; i + inc <= end; i += inc)
+        {
+            auto x = src.getAVX512 (i);
+            x = combine (x, R::template shiftUp<1> (x, id));
+            x = combine (x, R::template shiftUp<2> (x, id));
+            x = combine (x, R::template shiftUp<4> (x, id));
+
+            if constexpr (inc == 16)
+                x = combine (x, R::template shiftUp<8> (x, id));
+
+            // The carry is updated with the last element of the register scanned from the identity rather than with the
+            // last stored result. This gives the same value, but keeps the shuffle out of the dependency chain between
+            // consecutive registers.
+            combine (x, c).storeUnaligned (dst + i);
+            c = combine (c, R::broadcastLast (x));
+        }
+
+        if (i > begin)
+            carry = dst[i - 1];
+
+        scanElementWise (src, dst, i, end, carry);
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") static AVXRegister<T> combine (AVXRegister<T> a, AVXRegister<T> b)
+    requires Config::archX64
+    {
+        if constexpr (operation == CumulativeOperation::sum)
+            return AVXRegister<T>::add (a, b);
+
+        if constexpr (operation == CumulativeOperation::product)
+            return AVXRegister<T>::mul (a, b);
+
+        if constexpr (operation == CumulativeOperation::max)
+            return AVXRegister<T>::max (a, b);
+    }
+
+    template <class SrcType>
+    VCTR_TARGET ("avx") static void scanAVX (const SrcType& src, T* dst, size_t begin, size_t end, T carry)
+    requires Config::archX64
+    {
+        using R = AVXRegister<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto id = R::broadcast (identity);
+        auto c = R::broadcast (carry);
+
+        size_t i = begin;
+        for (; i + inc <= end; i += inc)
+        {
+            // Both 128 bit lanes are scanned separately, then the last element of the lower lane is combined into the
+            // upper lane
+            auto x = src.getAVX (i);
+            x = combine (x, R::template shiftUpWithinLanes<1> (x, id));
+
+            if constexpr (inc == 8)
+                x = combine (x, R::template shiftUpWithinLanes<2> (x, id));
+
+            x = combine (x, R::broadcastLastWithinLanes (R::shiftLanesUp (x, id)));
+
+            // See scanAVX512 for the carry
+            combine (x, c).storeUnaligned (dst + i);
+            c = combine (c, R::broadcastLast (x));
+        }
+
+        if (i > begin)
+            carry = dst[i - 1];
+
+        scanElementWise (src, dst, i, end, carry);
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") static SSERegister<T> combine (SSERegister<T> a, SSERegister<T> b)
+    requires Config::archX64
+    {
+        if constexpr (operation == CumulativeOperation::sum)
+            return SSERegister<T>::add (a, b);
+
+        if constexpr (operation == CumulativeOperation::product)
+            return SSERegister<T>::mul (a, b);
+
+        if constexpr (operation == CumulativeOperation::max)
+            return SSERegister<T>::max (a, b);
+    }
+
+    template <class SrcType>
+    VCTR_TARGET ("sse4.1") static void scanSSE (const SrcType& src, T* dst, size_t begin, size_t end, T carry)
+    requires Config::archX64
+    {
+        using R = SSERegister<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto id = R::broadcast (identity);
+        auto c = R::broadcast (carry);
+
+        size_t i = begin;
+        for (; i + inc <= end; i += inc)
+        {
+            auto x = src.getSSE (i);
+            x = combine (x, R::template shiftUp<1> (x, id));
+
+            if constexpr (inc == 4)
+                x = combine (x, R::template shiftUp<2> (x, id));
+
+            // See scanAVX512 for the carry
+            combine (x, c).storeUnaligned (dst + i);
+            c = combine (c, R::broadcastLast (x));
+        }
+
+        if (i > begin)
+            carry = dst[i - 1];
+
+        scanElementWise (src, dst, i, end, carry);
+    }
+};
+
+template <CumulativeOperation operation, class SrcType, class... PoolType>
+constexpr auto makeCumulative (const SrcType& src, PoolType&... pool)
+{
+    using T = vctr::ValueType<SrcType>;
+    constexpr auto extent = extentOf<SrcType>;
+
+    if constexpr (extent == std::dynamic_extent)
+    {
+        Vector<T> dst (src.size());
+        CumulativeScan<operation, T>::scan (src, dst.data(), pool...);
+        return dst;
+    }
+    else
+    {
+        Array<T, extent> dst;
+        CumulativeScan<operation, T>::scan (src, dst.data(), pool...);
+        return dst;
+    }
+}
+
+} // namespace vctr::detail
+
+namespace vctr
+{
+
+/** Writes the cumulative sum of the source values to dst, i.e. dst[i] = src[0] + ... + src[i].
+
+    src can be a Vector, Array, Span or an expression, dst must have the same size. Evaluating in place, e.g. with src
+    and dst referring to the same container, is explicitly allowed.
+
+    @see cumulativeSum (const SrcType&, DstType&&, ThreadPool&) to split the work across multiple threads.
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType, is::anyVctr DstType>
+constexpr void cumulativeSum (const SrcType& src, DstType&& dst)
+{
+    VCTR_ASSERT (src.size() == dst.size());
+    detail::CumulativeScan<detail::CumulativeOperation::sum, ValueType<DstType>>::scan (src, dst.data());
+}
+
+/** Writes the cumulative sum of the source values to dst, splitting the work across the threads of the pool.
+
+    Large sources are split into one block per pool thread. The blocks are scanned on the pool, which does not allocate
+    and blocks until all tasks are finished. Small sources are scanned on the calling thread. Since the blocks are
+    summed up in a different order, floating point results may differ slightly from the single threaded computation.
+
+    The pool must not be used by any other thread during the call.
+
+    @see cumulativeSum (const SrcType&, DstType&&) for the possible arguments.
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType, is::anyVctr DstType>
+void cumulativeSum (const SrcType& src, DstType&& dst, ThreadPool& pool)
+{
+    VCTR_ASSERT (src.size() == dst.size());
+    detail::CumulativeScan<detail::CumulativeOperation::sum, ValueType<DstType>>::scan (src, dst.data(), pool);
+}
+
+/** Returns the cumulative sum of the source values as an Array if src has a static extent, otherwise as a Vector.
+
+    @see cumulativeSum (const SrcType&, DstType&&)
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType>
+constexpr auto cumulativeSum (const SrcType& src)
+{
+    return detail::makeCumulative<detail::CumulativeOperation::sum> (src);
+}
+
+/** Returns the cumulative sum of the source values, splitting the work across the threads of the pool.
+
+    @see cumulativeSum (const SrcType&, DstType&&, ThreadPool&)
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType>
+auto cumulativeSum (const SrcType& src, ThreadPool& pool)
+{
+    return detail::makeCumulative<detail::CumulativeOperation::sum> (src, pool);
+}
+
+/** Writes the cumulative product of the source values to dst, i.e. dst[i] = src[0] * ... * src[i].
+
+    @see cumulativeSum (const SrcType&, DstType&&) for the possible arguments.
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType, is::anyVctr DstType>
+constexpr void cumulativeProduct (const SrcType& src, DstType&& dst)
+{
+    VCTR_ASSERT (src.size() == dst.size());
+    detail::CumulativeScan<detail::CumulativeOperation::product, ValueType<DstType>>::scan (src, dst.data());
+}
+
+/** Writes the cumulative product of the source values to dst, splitting the work across the threads of the pool.
+
+    @see cumulativeSum (const SrcType&, DstType&&, ThreadPool&) for details on the multi-threaded computation.
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType, is::anyVctr DstType>
+void cumulativeProduct (const SrcType& src, DstType&& dst, ThreadPool& pool)
+{
+    VCTR_ASSERT (src.size() == dst.size());
+    detail::CumulativeScan<detail::CumulativeOperation::product, ValueType<DstType>>::scan (src, dst.data(), pool);
+}
+
+/** Returns the cumulative product of the source values as an Array if src has a static extent, otherwise as a Vector.
+
+    @see cumulativeProduct (const SrcType&, DstType&&)
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType>
+constexpr auto cumulativeProduct (const SrcType& src)
+{
+    return detail::makeCumulative<detail::CumulativeOperation::product> (src);
+}
+
+/** Returns the cumulative product of the source values, splitting the work across the threads of the pool.
+
+    @see cumulativeSum (const SrcType&, DstType&&, ThreadPool&) for details on the multi-threaded computation.
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType>
+auto cumulativeProduct (const SrcType& src, ThreadPool& pool)
+{
+    return detail::makeCumulative<detail::CumulativeOperation::product> (src, pool);
+}
+
+/** Writes the running maximum of the source values to dst, i.e. dst[i] = max (src[0], ..., src[i]).
+
+    The results are unspecified if the source contains NaN values.
+
+    @see cumulativeSum (const SrcType&, DstType&&) for the possible arguments.
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType, is::anyVctr DstType>
+requires is::realNumber<ValueType<DstType>>
+constexpr void cumulativeMax (const SrcType& src, DstType&& dst)
+{
+    VCTR_ASSERT (src.size() == dst.size());
+    detail::CumulativeScan<detail::CumulativeOperation::max, ValueType<DstType>>::scan (src, dst.data());
+}
+
+/** Writes the running maximum of the source values to dst, splitting the work across the threads of the pool.
+
+    @see cumulativeSum (const SrcType&, DstType&&, ThreadPool&) for details on the multi-threaded computation.
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType, is::anyVctr DstType>
+requires is::realNumber<ValueType<DstType>>
+void cumulativeMax (const SrcType& src, DstType&& dst, ThreadPool& pool)
+{
+    VCTR_ASSERT (src.size() == dst.size());
+    detail::CumulativeScan<detail::CumulativeOperation::max, ValueType<DstType>>::scan (src, dst.data(), pool);
+}
+
+/** Returns the running maximum of the source values as an Array if src has a static extent, otherwise as a Vector.
+
+    @see cumulativeMax (const SrcType&, DstType&&)
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType>
+requires is::realNumber<ValueType<SrcType>>
+constexpr auto cumulativeMax (const SrcType& src)
+{
+    return detail::makeCumulative<detail::CumulativeOperation::max> (src);
+}
+
+/** Returns the running maximum of the source values, splitting the work across the threads of the pool.
+
+    @see cumulativeSum (const SrcType&, DstType&&, ThreadPool&) for details on the multi-threaded computation.
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType>
+requires is::realNumber<ValueType<SrcType>>
+auto cumulativeMax (const SrcType& src, ThreadPool& pool)
+{
+    return detail::makeCumulative<detail::CumulativeOperation::max> (src, pool);
+}
+
+} // namespace vctr
@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+
+namespace vctr
+{
+
+/** Evaluates an expression chain for a batch of independent sources on the threads of pool, i.e. it assigns
+    expression << srcs[i] to dsts[i] for all i.
+
+    dsts and srcs are random access ranges of the same size, e.g. a std::vector of Vector or Span instances. Every
+    source is evaluated as a separate task by a single thread, the work stealing of the pool balances sources of
+    different lengths across the threads. Vector destinations are resized to the size of their source, which only
+    allocates if it exceeds their capacity, so repeatedly evaluating batches of the same sizes does not allocate after
+    the first evaluation. All other destinations must match the size of their source. If the expression chain
+    terminates in a reduction, dsts can be a range of values that receive the reduction results. Like for a single
+    source, reductions are not allowed for empty sources.
+
+    The expression must be safe to evaluate concurrently and no destination may refer to the memory of another source.
+
+    @ingroup Algorithms
+ */
+template <std::ranges::random_access_range DstsType, std::ranges::random_access_range SrcsType, is::expressionChainBuilder ExpressionChain>
+void evaluateBatch (DstsType&& dsts, const SrcsType& srcs, const ExpressionChain& expression, ThreadPool& pool)
+{
+    VCTR_ASSERT (std::ranges::size (dsts) == std::ranges::size (srcs));
+
+    pool.parallelFor (std::ranges::size (srcs), [&] (size_t i)
+    {
+        std::ranges::begin (dsts)[i] = expression << std::ranges::begin (srcs)[i];
+    });
+}
+
+} // namespace vctr
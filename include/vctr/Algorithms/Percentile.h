@@ -0,0 +1,202 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::detail
+{
+
+/** The index of the closest rank at or below a percentile and the fraction to interpolate towards the next rank. */
+struct PercentileRank
+{
+    constexpr PercentileRank (double percentage, size_t n)
+    {
+        VCTR_ASSERT (percentage >= 0.0 && percentage <= 100.0);
+
+        const auto rank = percentage / 100.0 * double (n - 1);
+        index = std::min (size_t (rank), n - 1);
+        fraction = rank - double (index);
+    }
+
+    size_t index;
+    double fraction;
+};
+
+/** Linearly interpolates between the values at two adjacent ranks. */
+template <class T>
+constexpr vctr::FloatType<T> interpolateRanks (T lower, T upper, double fraction)
+{
+    using F = vctr::FloatType<T>;
+
+    if (fraction == 0.0)
+        return F (lower);
+
+    return F (lower) + F (fraction) * (F (upper) - F (lower));
+}
+
+/** Moves the elements at the ascending and unique ranks within [begin, end) to the positions they would have if all
+    elements were sorted. Selecting the middle rank first restricts the selection of all lower and higher ranks to the
+    elements in front of and behind it, so that each element is only partitioned about log2 (numRanks) times.
+ */
+template <class T>
+constexpr void selectRanks (Span<T> elements, size_t begin, size_t end, const size_t* ranks, size_t numRanks)
+{
+    if (numRanks == 0)
+        return;
+
+    const auto middle = numRanks / 2;
+    const auto rank = ranks[middle];
+
+    elements.subSpan (begin, end - begin).nthElement (rank - begin);
+
+    selectRanks (elements, begin, rank, ranks, middle);
+    selectRanks (elements, rank + 1, end, ranks + middle + 1, numRanks - middle - 1);
+}
+
+template <class SrcType, class PercentagesType, class DstType>
+constexpr void computePercentiles (const SrcType& src, const PercentagesType& percentages, DstType& dst)
+{
+    using T = vctr::ValueType<SrcType>;
+
+    const auto n = src.size();
+    VCTR_ASSERT (n > 0);
+
+    Vector<T> elements (src);
+    Vector<size_t> ranks;
+    ranks.reserve (2 * percentages.size());
+
+    for (auto p : percentages)
+    {
+        const PercentileRank rank (double (p), n);
+        ranks.push_back (rank.index);
+
+        if (rank.fraction > 0.0)
+            ranks.push_back (rank.index + 1);
+    }
+
+    ranks.sort();
+    ranks.resize (size_t (std::unique (ranks.begin(), ranks.end()) - ranks.begin()));
+
+    selectRanks (Span<T> (elements.data(), n), 0, n, ranks.data(), ranks.size());
+
+    for (size_t i = 0; i < percentages.size(); ++i)
+    {
+        const PercentileRank rank (double (percentages[i]), n);
+        const auto upper = rank.fraction > 0.0 ? elements[rank.index + 1] : elements[rank.index];
+        dst[i] = interpolateRanks (elements[rank.index], upper, rank.fraction);
+    }
+}
+
+} // namespace vctr::detail
+
+namespace vctr
+{
+
+/** Returns the percentile of the source values, with the percentage in the range [0, 100].
+
+    Like the default of most statistics packages, this interpolates linearly between the two closest ranks if the
+    percentile falls between them. The result is a floating point value, which is double for 32 and 64 bit integers.
+
+    The values are selected from a copy of the source, which can be a Vector, Array, Span or an expression, so the
+    source stays unchanged. This takes linear time on average, which is considerably faster than sorting the values
+    and is SIMD accelerated for float, double, int32_t and uint32_t values. The source must not be empty and the result
+    is unspecified if it contains NaN.
+
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType>
+requires is::realNumber<ValueType<SrcType>>
+constexpr FloatType<ValueType<SrcType>> percentile (const SrcType& src, double percentage)
+{
+    using T = ValueType<SrcType>;
+
+    const auto n = src.size();
+    VCTR_ASSERT (n > 0);
+
+    Vector<T> elements (src);
+    const detail::PercentileRank rank (percentage, n);
+
+    elements.nthElement (rank.index);
+    const auto lower = elements[rank.index];
+
+    if (rank.fraction == 0.0)
+        return FloatType<T> (lower);
+
+    // All elements behind the selected one are greater or equal, so the next rank is the smallest of them
+    const auto upper = min << elements.subSpan (rank.index + 1);
+
+    return detail::interpolateRanks (lower, upper, rank.fraction);
+}
+
+/** Returns the percentile of the source values, with the percentage in the range [0, 100] as template argument.
+
+    @see percentile (const SrcType&, double)
+    @ingroup Algorithms
+ */
+template <size_t percentage, is::anyVctrOrExpression SrcType>
+requires (percentage <= 100) && is::realNumber<ValueType<SrcType>>
+constexpr FloatType<ValueType<SrcType>> percentile (const SrcType& src)
+{
+    return percentile (src, double (percentage));
+}
+
+/** Returns the median of the source values, which is the mean of the two middle values for an even number of values.
+
+    @see percentile (const SrcType&, double)
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType>
+requires is::realNumber<ValueType<SrcType>>
+constexpr FloatType<ValueType<SrcType>> median (const SrcType& src)
+{
+    return percentile (src, 50.0);
+}
+
+/** Returns the percentiles of the source values for all percentages in the range [0, 100] as an Array if percentages
+    has a static extent, otherwise as a Vector.
+
+    This copies the source only once and selects all required ranks together, which is faster than computing each
+    percentile separately. The percentages don't need to be sorted.
+
+    @see percentile (const SrcType&, double)
+    @ingroup Algorithms
+ */
+template <is::anyVctrOrExpression SrcType, is::anyVctr PercentagesType>
+requires is::realNumber<ValueType<SrcType>> && is::realNumber<ValueType<PercentagesType>>
+constexpr auto percentiles (const SrcType& src, const PercentagesType& percentages)
+{
+    using F = FloatType<ValueType<SrcType>>;
+    constexpr auto extent = extentOf<PercentagesType>;
+
+    if constexpr (extent == std::dynamic_extent)
+    {
+        Vector<F> dst (percentages.size());
+        detail::computePercentiles (src, percentages, dst);
+        return dst;
+    }
+    else
+    {
+        Array<F, extent> dst;
+        detail::computePercentiles (src, percentages, dst);
+        return dst;
+    }
+}
+
+} // namespace vctr
@@ -0,0 +1,697 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::detail
+{
+
+template <class T>
+constexpr bool hasAcceleratedSort = std::same_as<T, float> || std::same_as<T, double> || std::same_as<T, int32_t> || std::same_as<T, uint32_t>;
+
+/** Returns a table of AVX2 permutation indices for each possible bit mask of a register holding elements of type T.
+    The indices move all elements whose bit is set to the front and all others to the back, both in their original order.
+ */
+template <class T>
+consteval auto makeAVX2PartitionPermutations()
+{
+    constexpr size_t numElements = 32 / sizeof (T);
+    constexpr size_t numIndicesPerElement = sizeof (T) / sizeof (int32_t);
+
+    std::array<std::array<int32_t, 8>, size_t (1) << numElements> permutations {};
+
+    for (size_t mask = 0; mask < permutations.size(); ++mask)
+    {
+        size_t j = 0;
+
+        for (auto left : { size_t (1), size_t (0) })
+            for (size_t i = 0; i < numElements; ++i)
+                if (((mask >> i) & 1) == left)
+                    for (size_t k = 0; k < numIndicesPerElement; ++k)
+                        permutations[mask][j++] = int32_t (i * numIndicesPerElement + k);
+    }
+
+    return permutations;
+}
+
+/** Implements VctrBase::sort, nthElement and partialSort for float, double, int32_t and uint32_t elements.
+
+    On CPUs with AVX512 or AVX2 support, the elements are sorted by a quicksort that partitions whole registers at once.
+    AVX512 writes the elements of both partitions with compressing stores, AVX2 permutes the elements of each partition
+    to one end of the register by an index table lookup and writes the whole register to both sides. Partitions that
+    fit into eight registers are sorted by bitonic sorting networks. The selection of the nth element uses the same
+    partitioning, but only continues with the partition that contains it.
+ */
+template <class T>
+struct AcceleratedSort
+{
+    /** Sorts the elements in ascending order. For floating point values, all NaNs are moved behind all other values. */
+    static constexpr void sort (T* data, size_t n)
+    {
+        n = moveNaNsToEnd (data, n);
+
+        if (! std::is_constant_evaluated())
+        {
+            if constexpr (Config::archX64)
+            {
+                if (Config::supportsAVX512)
+                    return quicksort<CPUInstructionSet::avx512> (data, n, maxRecursionDepth (n));
+
+                if (Config::supportsAVX2)
+                    return quicksort<CPUInstructionSet::avx2> (data, n, maxRecursionDepth (n));
+            }
+        }
+
+        std::sort (data, data + n);
+    }
+
+    /** Rearranges the elements so that the element at index nth is the one that would be there if all elements were
+        sorted. No element before it is greater and no element after it is less than it.
+     */
+    static constexpr void nthElement (T* data, size_t n, size_t nth)
+    {
+        n = moveNaNsToEnd (data, n);
+
+        // The element at nth is a NaN and all elements before it are numbers
+        if (nth >= n)
+            return;
+
+        if (! std::is_constant_evaluated())
+        {
+            if constexpr (Config::archX64)
+            {
+                if (Config::supportsAVX512)
+                    return quickselect<CPUInstructionSet::avx512> (data, n, nth, maxRecursionDepth (n));
+
+                if (Config::supportsAVX2)
+                    return quickselect<CPUInstructionSet::avx2> (data, n, nth, maxRecursionDepth (n));
+            }
+        }
+
+        std::nth_element (data, data + nth, data + n);
+    }
+
+    /** Moves the numElements smallest elements to the front in ascending order. */
+    static constexpr void partialSort (T* data, size_t n, size_t numElements)
+    {
+        if (numElements < n)
+            nthElement (data, n, numElements);
+
+        sort (data, numElements);
+    }
+
+private:
+    //==============================================================================
+    template <CPUInstructionSet instructionSet>
+    static constexpr size_t numRegisterElements = (instructionSet == CPUInstructionSet::avx512 ? 64 : 32) / sizeof (T);
+
+    /** Partitions with up to this number of elements are sorted by sorting networks. */
+    template <CPUInstructionSet instructionSet>
+    static constexpr size_t maxSortingNetworkSize = 8 * numRegisterElements<instructionSet>;
+
+    /** Registers of the sorting networks are padded with this, so that the padding stays behind the sorted elements. */
+    static constexpr T paddingValue = is::realFloatNumber<T> ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+
+    static constexpr auto avx2PartitionPermutations = makeAVX2PartitionPermutations<T>();
+
+    /** Loading eight elements from index 8 - i selects the first i 32 bit elements of an AVX2 masked load or store. */
+    static constexpr std::array<int32_t, 16> avx2ElementMasks { -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    /** Moves all NaNs behind all other elements and returns the number of other elements. */
+    static constexpr size_t moveNaNsToEnd (T* data, size_t n)
+    {
+        if constexpr (is::realFloatNumber<T>)
+        {
+            // NaN is the only value that is not equal to itself
+            return size_t (std::partition (data, data + n, [] (T x) { return x == x; }) - data);
+        }
+
+        return n;
+    }
+
+    /** Exceeding this depth indicates that the chosen pivots are bad for the input data. */
+    static int maxRecursionDepth (size_t n) { return 2 * int (std::bit_width (n)); }
+
+    template <CPUInstructionSet instructionSet>
+    static void quicksort (T* data, size_t n, int remainingDepth)
+    {
+        while (n > maxSortingNetworkSize<instructionSet>)
+        {
+            // std::sort guarantees a O(n log n) worst case complexity
+            if (remainingDepth-- == 0)
+            {
+                std::sort (data, data + n);
+                return;
+            }
+
+            const auto pivot = choosePivot (data, n);
+            const auto numLess = partition<instructionSet, false> (data, n, pivot);
+
+            // The pivot is the smallest element. All elements equal to it are at their final position after moving
+            // them to the front, which also prevents a quadratic runtime for inputs with many equal elements.
+            if (numLess == 0)
+            {
+                const auto numEqual = partition<instructionSet, true> (data, n, pivot);
+                data += numEqual;
+                n -= numEqual;
+                continue;
+            }
+
+            // Recursing into the smaller partition only limits the stack depth to log2 (n)
+            if (numLess < n - numLess)
+            {
+                quicksort<instructionSet> (data, numLess, remainingDepth);
+                data += numLess;
+                n -= numLess;
+            }
+            else
+            {
+                quicksort<instructionSet> (data + numLess, n - numLess, remainingDepth);
+                n = numLess;
+            }
+        }
+
+        sortingNetwork<instructionSet> (data, n);
+    }
+
+    /** Only selects the partition that contains the element at index nth rather than sorting both. */
+    template <CPUInstructionSet instructionSet>
+    static void quickselect (T* data, size_t n, size_t nth, int remainingDepth)
+    {
+        while (n > maxSortingNetworkSize<instructionSet>)
+        {
+            if (remainingDepth-- == 0)
+            {
+                std::nth_element (data, data + nth, data + n);
+                return;
+            }
+
+            const auto pivot = choosePivot (data, n);
+            const auto numLess = partition<instructionSet, false> (data, n, pivot);
+
+            // See quicksort
+            if (numLess == 0)
+            {
+                const auto numEqual = partition<instructionSet, true> (data, n, pivot);
+
+                if (nth < numEqual)
+                    return;
+
+                data += numEqual;
+                n -= numEqual;
+                nth -= numEqual;
+                continue;
+            }
+
+            if (nth < numLess)
+            {
+                n = numLess;
+            }
+            else
+            {
+                data += numLess;
+                n -= numLess;
+                nth -= numLess;
+            }
+        }
+
+        sortingNetwork<instructionSet> (data, n);
+    }
+
+    template <CPUInstructionSet instructionSet>
+    static void sortingNetwork (T* data, size_t n)
+    {
+        constexpr auto inc = numRegisterElements<instructionSet>;
+
+        if (n < 2)
+            return;
+
+        const auto numRegisters = std::bit_ceil ((n + inc - 1) / inc);
+
+        if constexpr (instructionSet == CPUInstructionSet::avx512)
+        {
+            switch (numRegisters)
+            {
+                case 1:  sortRegistersAVX512<1> (data, n); break;
+                case 2:  sortRegistersAVX512<2> (data, n); break;
+                case 4:  sortRegistersAVX512<4> (data, n); break;
+                default: sortRegistersAVX512<8> (data, n); break;
+            }
+        }
+        else
+        {
+            switch (numRegisters)
+            {
+                case 1:  sortRegistersAVX2<1> (data, n); break;
+                case 2:  sortRegistersAVX2<2> (data, n); break;
+                case 4:  sortRegistersAVX2<4> (data, n); break;
+                default: sortRegistersAVX2<8> (data, n); break;
+            }
+        }
+    }
+
+    static T medianOfThree (T a, T b, T c)
+    {
+        return std::max (std::min (a, b), std::min (std::max (a, b), c));
+    }
+
+    /** Returns the median of three samples or for larger sizes the median of the medians of three times three samples. */
+    static T choosePivot (const T* data, size_t n)
+    {
+        const auto q = n / 4;
+
+        if (n < 1024)
+            return medianOfThree (data[q], data[2 * q], data[3 * q]);
+
+        const auto d = n / 16;
+
+        return medianOfThree (medianOfThree (data[q - d], data[q], data[q + d]),
+                              medianOfThree (data[2 * q - d], data[2 * q], data[2 * q + d]),
+                              medianOfThree (data[3 * q - d], data[3 * q], data[3 * q + d]));
+    }
+
+    /** Moves all elements less than the pivot, or less than or equal to it if orEqual is true, to the front and returns
+        their number.
+     */
+    template <CPUInstructionSet instructionSet, bool orEqual>
+    static size_t partition (T* data, size_t n, T pivot)
+    {
+        if constexpr (instructionSet == CPUInstructionSet::avx512)
+            return partitionAVX512<orEqual> (data, n, pivot);
+        else
+            return partitionAVX2<orEqual> (data, n, pivot);
+    }
+
+    /** Writes the elements of src to the free elements of dst in the range [writeLeft, writeRight), without branching
+        on the comparison result. src must not overlap that range.
+     */
+    template <bool orEqual>
+    static void partitionElementWise (const T* src, size_t n, T* dst, size_t& writeLeft, size_t& writeRight, T pivot)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto x = src[i];
+            const bool left = orEqual ? ! (pivot < x) : x < pivot;
+
+            dst[writeLeft] = x;
+            dst[writeRight - 1] = x;
+            writeLeft += size_t (left);
+            writeRight -= size_t (! left);
+        }
+    }
+
+    /** Returns a bit mask with the bits set for the lanes that take the greater element in the step of a bitonic sorting
+        network that compares elements with a distance of j in sequences of length k.
+     */
+    template <size_t numElements, size_t k, size_t j>
+    static consteval uint32_t upperLanes()
+    {
+        uint32_t mask = 0;
+
+        for (size_t i = 0; i < numElements; ++i)
+            if (((i & j) != 0) != ((i & k) != 0))
+                mask |= uint32_t (1) << i;
+
+        return mask;
+    }
+
+    //==============================================================================
+    // AVX512 Implementation
+    template <bool orEqual>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void partitionRegisterAVX512 (const AVX512Register<T>& x, const AVX512Register<T>& pivot, T* data, size_t& writeLeft, size_t& writeRight)
+    requires Config::archX64
+    {
+        using R = AVX512Register<T>;
+
+        auto left = R::lessThan (x, pivot);
+
+        if constexpr (orEqual)
+            left = decltype (left) (~R::greaterThan (x, pivot));
+
+        const auto numLeft = size_t (std::popcount (uint32_t (left)));
+
+        x.storeCompressed (data + writeLeft, left);
+        writeLeft += numLeft;
+        writeRight -= R::numElements - numLeft;
+        x.storeCompressed (data + writeRight, decltype (left) (~left));
+    }
+
+    template <bool orEqual>
+    VCTR_TARGET ("avx512f") static size_t partitionAVX512 (T* data, size_t n, T pivot)
+    requires Config::archX64
+    {
+        using R = AVX512Register<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto p = R::broadcast (pivot);
+
+        // The first and the last register are kept aside, so that there are inc free elements on both sides to write to
+        const auto first = R::loadUnaligned (data);
+        const auto last = R::loadUnaligned (data + n - inc);
+
+        size_t readLeft = inc, readRight = n - inc;
+        size_t writeLeft = 0, writeRight = n;
+
+        while (readLeft + inc <= readRight)
+        {
+            // Reading from the side with less free elements keeps at least inc free elements on both sides
+            R x;
+
+            if (readLeft - writeLeft <= writeRight - readRight)
+            {
+                x = R::loadUnaligned (data + readLeft);
+                readLeft += inc;
+            }
+            else
+            {
+                readRight -= inc;
+                x = R::loadUnaligned (data + readRight);
+            }
+
+            partitionRegisterAVX512<orEqual> (x, p, data, writeLeft, writeRight);
+        }
+
+        // After copying the remaining elements aside, all elements in [writeLeft, writeRight) are free
+        T remaining[inc];
+        const auto numRemaining = readRight - readLeft;
+        std::copy (data + readLeft, data + readRight, remaining);
+
+        partitionRegisterAVX512<orEqual> (first, p, data, writeLeft, writeRight);
+        partitionRegisterAVX512<orEqual> (last, p, data, writeLeft, writeRight);
+        partitionElementWise<orEqual> (remaining, numRemaining, data, writeLeft, writeRight, pivot);
+
+        return writeLeft;
+    }
+
+    /** Performs one step of a bitonic sorting network that compares elements with a distance of j in sequences of
+        length k. The lanes of equal elements are exchanged rather than duplicated, which matters for 0 and -0 in
+        floating point registers.
+
+        All sorting network functions take registers by reference, so that their results don't depend on them being
+        inlined into a function with the same target. Out of line copies of functions that take or return registers by
+        value are not guaranteed to use the right calling convention when compiled without a matching -march flag.
+     */
+    template <size_t k, size_t j>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void bitonicStepAVX512 (AVX512Register<T>& x)
+    requires Config::archX64
+    {
+        using R = AVX512Register<T>;
+
+        const auto p = R::template swapAdjacentGroups<int (j)> (x);
+        x = R::select (upperLanes<R::numElements, k, j>(), R::max (x, p), R::min (x, p));
+    }
+
+    /** Performs all steps of a bitonic sorting network for sequences of length k, from a distance of k / 2 down to 1. */
+    template <size_t k, size_t... s>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void bitonicStepsAVX512 (AVX512Register<T>& x, std::index_sequence<s...>)
+    requires Config::archX64
+    {
+        (bitonicStepAVX512<k, (k >> (s + 1))> (x), ...);
+    }
+
+    /** Sorts a register by bitonic sorting networks for sequences of length 2, 4, ..., numElements. */
+    template <size_t... s>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void sortRegisterAVX512 (AVX512Register<T>& x, std::index_sequence<s...>)
+    requires Config::archX64
+    {
+        (bitonicStepsAVX512<(size_t (2) << s)> (x, std::make_index_sequence<s + 1>()), ...);
+    }
+
+    /** Sorts a register that holds a bitonic sequence */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void mergeRegisterAVX512 (AVX512Register<T>& x)
+    requires Config::archX64
+    {
+        constexpr auto numElements = AVX512Register<T>::numElements;
+
+        bitonicStepsAVX512<numElements> (x, std::make_index_sequence<std::bit_width (numElements) - 1>());
+    }
+
+    /** Sorts the n elements in numRegisters registers. The registers are loaded and stored partially, so that no
+        element outside of [0, n) is accessed, and padded with paddingValue.
+     */
+    template <size_t numRegisters>
+    VCTR_TARGET ("avx512f") static void sortRegistersAVX512 (T* data, size_t n)
+    requires Config::archX64
+    {
+        using R = AVX512Register<T>;
+        constexpr auto inc = R::numElements;
+
+        R x[numRegisters];
+
+        for (size_t i = 0; i < numRegisters; ++i)
+        {
+            loadPaddedAVX512 (x[i], data, n, i * inc);
+            sortRegisterAVX512 (x[i], std::make_index_sequence<std::bit_width (inc) - 1>());
+        }
+
+        if constexpr (numRegisters > 1)
+            mergeSequencesAVX512<1> (x);
+
+        for (size_t i = 0; i < numRegisters && i * inc < n; ++i)
+            x[i].storeUnalignedMasked (data + i * inc, elementsMaskAVX512 (n, i * inc));
+    }
+
+    /** Returns the mask that selects the elements of a register starting at begin that are less than n */
+    VCTR_FORCEDINLINE static uint32_t elementsMaskAVX512 (size_t n, size_t begin)
+    {
+        return (uint32_t (1) << std::min (n - begin, numRegisterElements<CPUInstructionSet::avx512>)) - 1;
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void loadPaddedAVX512 (AVX512Register<T>& x, const T* data, size_t n, size_t begin)
+    requires Config::archX64
+    {
+        const auto padding = AVX512Register<T>::broadcast (paddingValue);
+
+        x = begin < n ? AVX512Register<T>::loadUnalignedMasked (data + begin, elementsMaskAVX512 (n, begin), padding) : padding;
+    }
+
+    /** Merges each two neighbouring sorted sequences of m registers into a sorted sequence of 2 * m registers, until all
+        registers form one sorted sequence. Reversing the second sequence turns both into a single bitonic sequence.
+     */
+    template <size_t m, size_t n>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void mergeSequencesAVX512 (AVX512Register<T> (&x)[n])
+    requires Config::archX64
+    {
+        for (size_t begin = m; begin < n; begin += 2 * m)
+        {
+            std::reverse (x + begin, x + begin + m);
+
+            for (size_t i = begin; i < begin + m; ++i)
+                x[i] = AVX512Register<T>::reverse (x[i]);
+        }
+
+        for (size_t d = m; d > 0; d /= 2)
+            for (size_t p = 0; p < n / 2; ++p)
+                compareExchangeAVX512 (x[p / d * 2 * d + p % d], x[p / d * 2 * d + p % d + d]);
+
+        for (size_t i = 0; i < n; ++i)
+            mergeRegisterAVX512 (x[i]);
+
+        if constexpr (2 * m < n)
+            mergeSequencesAVX512<2 * m> (x);
+    }
+
+    /** Compares and exchanges two registers. The swapped arguments to max exchange equal elements rather than
+        duplicating them, see bitonicStepAVX512.
+     */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void compareExchangeAVX512 (AVX512Register<T>& a, AVX512Register<T>& b)
+    requires Config::archX64
+    {
+        const auto lo = AVX512Register<T>::min (a, b);
+        b = AVX512Register<T>::max (b, a);
+        a = lo;
+    }
+
+    //==============================================================================
+    // AVX2 Implementation
+    template <bool orEqual>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void partitionRegisterAVX2 (const AVXRegister<T>& x, const AVXRegister<T>& pivot, T* data, size_t& writeLeft, size_t& writeRight)
+    requires Config::archX64
+    {
+        using R = AVXRegister<T>;
+        constexpr auto inc = R::numElements;
+
+        auto left = R::toBitMask (R::lessThan (x, pivot));
+
+        if constexpr (orEqual)
+            left = R::toBitMask (R::greaterThan (x, pivot)) ^ ((uint32_t (1) << inc) - 1);
+
+        const auto numLeft = size_t (std::popcount (left));
+
+        // Both sides have at least inc free elements, so the whole permuted register is written to both of them. The
+        // elements of the other partition are overwritten by later writes.
+        const auto permuted = R::permute (x, avx2PartitionPermutations[left].data());
+        permuted.storeUnaligned (data + writeLeft);
+        permuted.storeUnaligned (data + writeRight - inc);
+        writeLeft += numLeft;
+        writeRight -= inc - numLeft;
+    }
+
+    template <bool orEqual>
+    VCTR_TARGET ("avx2") static size_t partitionAVX2 (T* data, size_t n, T pivot)
+    requires Config::archX64
+    {
+        using R = AVXRegister<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto p = R::broadcast (pivot);
+
+        // The first and the last register are copied aside, so that there are inc free elements on both sides to write to
+        T remaining[3 * inc];
+        std::copy (data, data + inc, remaining);
+        std::copy (data + n - inc, data + n, remaining + inc);
+
+        size_t readLeft = inc, readRight = n - inc;
+        size_t writeLeft = 0, writeRight = n;
+
+        while (readLeft + inc <= readRight)
+        {
+            // See partitionAVX512
+            R x;
+
+            if (readLeft - writeLeft <= writeRight - readRight)
+            {
+                x = R::loadUnaligned (data + readLeft);
+                readLeft += inc;
+            }
+            else
+            {
+                readRight -= inc;
+                x = R::loadUnaligned (data + readRight);
+            }
+
+            partitionRegisterAVX2<orEqual> (x, p, data, writeLeft, writeRight);
+        }
+
+        // Writing whole registers needs more free elements than there are left, so the rest is partitioned element wise
+        const auto numRemaining = 2 * inc + readRight - readLeft;
+        std::copy (data + readLeft, data + readRight, remaining + 2 * inc);
+        partitionElementWise<orEqual> (remaining, numRemaining, data, writeLeft, writeRight, pivot);
+
+        return writeLeft;
+    }
+
+    /** See bitonicStepAVX512 */
+    template <size_t k, size_t j>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void bitonicStepAVX2 (AVXRegister<T>& x)
+    requires Config::archX64
+    {
+        using R = AVXRegister<T>;
+
+        const auto p = R::template swapAdjacentGroups<int (j)> (x);
+        x = R::template blend<int (upperLanes<R::numElements, k, j>())> (R::min (x, p), R::max (x, p));
+    }
+
+    template <size_t k, size_t... s>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void bitonicStepsAVX2 (AVXRegister<T>& x, std::index_sequence<s...>)
+    requires Config::archX64
+    {
+        (bitonicStepAVX2<k, (k >> (s + 1))> (x), ...);
+    }
+
+    template <size_t... s>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void sortRegisterAVX2 (AVXRegister<T>& x, std::index_sequence<s...>)
+    requires Config::archX64
+    {
+        (bitonicStepsAVX2<(size_t (2) << s)> (x, std::make_index_sequence<s + 1>()), ...);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void mergeRegisterAVX2 (AVXRegister<T>& x)
+    requires Config::archX64
+    {
+        constexpr auto numElements = AVXRegister<T>::numElements;
+
+        bitonicStepsAVX2<numElements> (x, std::make_index_sequence<std::bit_width (numElements) - 1>());
+    }
+
+    /** See sortRegistersAVX512 */
+    template <size_t numRegisters>
+    VCTR_TARGET ("avx2") static void sortRegistersAVX2 (T* data, size_t n)
+    requires Config::archX64
+    {
+        using R = AVXRegister<T>;
+        constexpr auto inc = R::numElements;
+
+        R x[numRegisters];
+
+        for (size_t i = 0; i < numRegisters; ++i)
+        {
+            loadPaddedAVX2 (x[i], data, n, i * inc);
+            sortRegisterAVX2 (x[i], std::make_index_sequence<std::bit_width (inc) - 1>());
+        }
+
+        if constexpr (numRegisters > 1)
+            mergeSequencesAVX2<1> (x);
+
+        for (size_t i = 0; i < numRegisters && i * inc < n; ++i)
+            x[i].storeUnalignedMasked (data + i * inc, elementsMaskAVX2 (n, i * inc));
+    }
+
+    /** See elementsMaskAVX512 */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static __m256i elementsMaskAVX2 (size_t n, size_t begin)
+    requires Config::archX64
+    {
+        const auto numElements = std::min (n - begin, numRegisterElements<CPUInstructionSet::avx2>);
+        return AVXRegister<int32_t>::loadUnaligned (avx2ElementMasks.data() + 8 - numElements * sizeof (T) / sizeof (int32_t)).value;
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void loadPaddedAVX2 (AVXRegister<T>& x, const T* data, size_t n, size_t begin)
+    requires Config::archX64
+    {
+        const auto padding = AVXRegister<T>::broadcast (paddingValue);
+
+        x = begin < n ? AVXRegister<T>::loadUnalignedMasked (data + begin, elementsMaskAVX2 (n, begin), padding) : padding;
+    }
+
+    /** See mergeSequencesAVX512 */
+    template <size_t m, size_t n>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void mergeSequencesAVX2 (AVXRegister<T> (&x)[n])
+    requires Config::archX64
+    {
+        for (size_t begin = m; begin < n; begin += 2 * m)
+        {
+            std::reverse (x + begin, x + begin + m);
+
+            for (size_t i = begin; i < begin + m; ++i)
+                x[i] = AVXRegister<T>::reverse (x[i]);
+        }
+
+        for (size_t d = m; d > 0; d /= 2)
+            for (size_t p = 0; p < n / 2; ++p)
+                compareExchangeAVX2 (x[p / d * 2 * d + p % d], x[p / d * 2 * d + p % d + d]);
+
+        for (size_t i = 0; i < n; ++i)
+            mergeRegisterAVX2 (x[i]);
+
+        if constexpr (2 * m < n)
+            mergeSequencesAVX2<2 * m> (x);
+    }
+
+    /** See compareExchangeAVX512 */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void compareExchangeAVX2 (AVXRegister<T>& a, AVXRegister<T>& b)
+    requires Config::archX64
+    {
+        const auto lo = AVXRegister<T>::min (a, b);
+        b = AVXRegister<T>::max (b, a);
+        a = lo;
+    }
+};
+
+} // namespace vctr::detail
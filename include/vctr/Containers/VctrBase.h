@@ -263,7 +263,7 @@ public:
     {
         if constexpr (has::resize<StorageType>)
         {
-            storage.resize (elements.size());
+            detail::resizeUninitialized (storage, elements.size());
         }
         else
         {
@@ -644,19 +644,11 @@ public:
         return std::min_element (begin(), end());
     }
 
-    /** Returns the index of the first greatest element (aka argMax). */
-    [[nodiscard]] size_t indexOfMaxElement() const
-    requires std::totally_ordered<value_type>
-    {
-        return std::distance (begin(), findMaxElement());
-    }
+    /** Returns the index of the first greatest element (aka argMax) or 0 if the container is empty. */
+    [[nodiscard]] constexpr size_t indexOfMaxElement() const requires std::totally_ordered<value_type>;
 
-    /** Returns the index of the first smallest element (aka argMin). */
-    [[nodiscard]] size_t indexOfMinElement() const
-    requires std::totally_ordered<value_type>
-    {
-        return std::distance (begin(), findMinElement());
-    }
+    /** Returns the index of the first smallest element (aka argMin) or 0 if the container is empty. */
+    [[nodiscard]] constexpr size_t indexOfMinElement() const requires std::totally_ordered<value_type>;
 
     /** Returns a std::optional holding a copy of the first element value which is greater or equal to valueToLookFor or
         std::nullopt if no such value is found.
@@ -756,12 +748,32 @@ public:
             clear (data(), n);
     }
 
-    /** Sorts all elements in an ascending order using operator <=>. */
+    /** Sorts all elements in an ascending order using operator <=>.
+
+        For float, double, int32_t and uint32_t elements, this uses a SIMD accelerated sort on CPUs that support AVX2
+        or AVX512. For floating point values, all NaNs are moved behind all other values.
+     */
     constexpr void sort()
-    requires std::totally_ordered<value_type>
-    {
-        std::sort (begin(), end());
-    }
+    requires std::totally_ordered<value_type>;
+
+    /** Rearranges the elements so that the element at index n is the one that would be there if all elements were
+        sorted. No element before it is greater and no element after it is less than it, the order of the elements on
+        both sides is unspecified.
+
+        This takes linear time on average. For float, double, int32_t and uint32_t elements, it is SIMD accelerated
+        like sort(). For floating point values, all NaNs are moved behind all other values.
+     */
+    constexpr void nthElement (size_t n)
+    requires std::totally_ordered<value_type>;
+
+    /** Moves the numElements smallest elements to the front, sorted in ascending order. The order of the remaining
+        elements is unspecified.
+
+        For float, double, int32_t and uint32_t elements, this is SIMD accelerated like sort(). For floating point
+        values, all NaNs are moved behind all other values.
+     */
+    constexpr void partialSort (size_t numElements)
+    requires std::totally_ordered<value_type>;
 
     /** Sorts all elements in this vector according to the compare function.
 
@@ -788,18 +800,30 @@ public:
     NeonRegister<std::remove_const_t<ElementType>> getNeon (size_t i) const
     requires archARM && is::realNumber<ElementType>
     {
-        VCTR_ASSERT (i % NeonRegister<std::remove_const_t<ElementType>>::numElements == 0);
         return NeonRegister<std::remove_const_t<ElementType>>::load (data() + i);
     }
 
+    void prepareAVX512Evaluation() const {}
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f")
+    AVX512Register<std::remove_const_t<ElementType>> getAVX512 (size_t i) const
+    requires archX64 && is::realNumber<ElementType>
+    {
+        // i is only unaligned for the final overlapping register of a non SIMD extended storage
+        if (StorageInfoType::dataIsSIMDAligned && i % AVX512Register<std::remove_const_t<ElementType>>::numElements == 0)
+            return AVX512Register<std::remove_const_t<ElementType>>::loadAligned (data() + i);
+        else
+            return AVX512Register<std::remove_const_t<ElementType>>::loadUnaligned (data() + i);
+    }
+
     void prepareAVXEvaluation() const {}
 
-    VCTR_TARGET ("avx")
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx")
     AVXRegister<std::remove_const_t<ElementType>> getAVX (size_t i) const
     requires archX64 && is::realNumber<ElementType>
     {
-        VCTR_ASSERT (i % AVXRegister<std::remove_const_t<ElementType>>::numElements == 0);
-        if (StorageInfoType::dataIsSIMDAligned)
+        // i is only unaligned for the final overlapping register of a non SIMD extended storage
+        if (StorageInfoType::dataIsSIMDAligned && i % AVXRegister<std::remove_const_t<ElementType>>::numElements == 0)
             return AVXRegister<std::remove_const_t<ElementType>>::loadAligned (data() + i);
         else
             return AVXRegister<std::remove_const_t<ElementType>>::loadUnaligned (data() + i);
@@ -807,12 +831,12 @@ public:
 
     void prepareSSEEvaluation() const {}
 
-    VCTR_TARGET ("sse4.1")
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1")
     SSERegister<std::remove_const_t<ElementType>> getSSE (size_t i) const
     requires archX64 && is::realNumber<ElementType>
     {
-        VCTR_ASSERT (i % SSERegister<std::remove_const_t<ElementType>>::numElements == 0);
-        if (StorageInfoType::dataIsSIMDAligned)
+        // i is only unaligned for the final overlapping register of a non SIMD extended storage
+        if (StorageInfoType::dataIsSIMDAligned && i % SSERegister<std::remove_const_t<ElementType>>::numElements == 0)
             return SSERegister<std::remove_const_t<ElementType>>::loadAligned (data() + i);
         else
             return SSERegister<std::remove_const_t<ElementType>>::loadUnaligned (data() + i);
@@ -830,6 +854,41 @@ public:
         assignExpressionTemplate (expression << *this);
     }
 
+    /** Assigns the result of an expression to this instance, evaluating chunks of it in parallel on the threads of pool.
+
+        Each thread evaluates a cache sized chunk with the same SIMD implementation as a regular assignment. This pays
+        off for long chains of costly element-wise expressions like exp or pow on large vectors, for short vectors or
+        if the pool has a single thread only, this falls back to a regular assignment. The expression is not evaluated
+        with the vector operations of accelerated backends like IPP or Apple Accelerate in this case, and it must be
+        safe to evaluate different elements of it concurrently, e.g. transformedBy must not use a function with side
+        effects. A resizable container is resized to the expression size, all others have to match it already.
+     */
+    template <is::expression Expression>
+    void assignParallel (const Expression& e, ThreadPool& pool)
+    {
+        resizeOrAssertSizeMatches (e.size());
+
+        constexpr auto chunkSize = parallelChunkSize;
+        constexpr size_t minNumChunks = 4;
+
+        const auto n = size();
+        const auto numChunks = (n + chunkSize - 1) / chunkSize;
+
+        if (pool.getNumThreads() < 2 || numChunks < minNumChunks)
+        {
+            assignExpressionTemplate (e);
+            return;
+        }
+
+        assignExpressionTemplateInRanges (e, [&] (const auto& assignRange)
+        {
+            pool.parallelFor (numChunks, [&] (size_t chunk)
+            {
+                assignRange (chunk * chunkSize, std::min (n, (chunk + 1) * chunkSize));
+            });
+        });
+    }
+
     constexpr bool isNotAliased (const void*) const { return true; }
 
     VCTR_FORCEDINLINE const ElementType* evalNextVectorOpInExpressionChain (void*) const { return data(); }
@@ -928,6 +987,12 @@ public:
     constexpr bool anyElementIsNaN() requires is::complexFloatNumber<ElementType>;
 
 protected:
+    //==============================================================================
+    /** The number of elements that are evaluated as one task by parallel evaluations like assignParallel. These are
+        32 kB of elements, which is a multiple of all SIMD register sizes.
+     */
+    static constexpr size_t parallelChunkSize = std::max (size_t (64), size_t (32768) / sizeof (ElementType));
+
     //==============================================================================
     constexpr VctrBase()
     {
@@ -953,7 +1018,7 @@ protected:
     constexpr void resizeOrAssertSizeMatches (size_t desiredSize)
     requires has::resize<StorageType>
     {
-        storage.resize (desiredSize);
+        detail::resizeUninitialized (storage, desiredSize);
     }
 
     /** Asserts that the current size matches the desired size. */
@@ -1003,46 +1068,78 @@ protected:
                 }
             }
 
-            if constexpr (has::getNeon<Expression>)
+            assignExpressionTemplateInRanges (e, [&] (const auto& assignRange) { assignRange (size_t (0), size()); });
+            return;
+        }
+
+        const auto n = size();
+
+        for (size_t i = 0; i < n; ++i)
+            storage[i] = e[i];
+    }
+
+    /** Prepares the expression for the best available instruction set and calls forEachRange with a function that
+        assigns the expression to the elements in a range [begin, end). forEachRange has to call it for ranges that
+        cover all elements, but might do so concurrently. All ranges except the last one must start and end at a
+        multiple of the SIMD register size.
+     */
+    template <is::expression Expression, class ForEachRange>
+    void assignExpressionTemplateInRanges (const Expression& e, ForEachRange&& forEachRange)
+    {
+        if constexpr (has::getNeon<Expression>)
+        {
+            e.prepareNeonEvaluation();
+            forEachRange ([&] (size_t begin, size_t end) { assignExpressionTemplateNeon (e, begin, end); });
+            return;
+        }
+
+        if constexpr (has::getAVX512<Expression>)
+        {
+            if (supportsAVX512)
             {
-                assignExpressionTemplateNeon (e);
+                prepareAVX512 (e);
+                forEachRange ([&] (size_t begin, size_t end) { assignExpressionTemplateAVX512 (e, begin, end); });
                 return;
             }
+        }
 
-            if constexpr (has::getAVX<Expression>)
+        if constexpr (has::getAVX<Expression>)
+        {
+            if constexpr (is::realFloatNumber<ElementType>)
             {
-                if constexpr (is::realFloatNumber<ElementType>)
-                {
-                    if (supportsAVX)
-                    {
-                        assignExpressionTemplateAVX (e);
-                        return;
-                    }
-                }
-                else
+                if (supportsAVX)
                 {
-                    if (supportsAVX2)
-                    {
-                        assignExpressionTemplateAVX2 (e);
-                        return;
-                    }
+                    prepareAVX (e);
+                    forEachRange ([&] (size_t begin, size_t end) { assignExpressionTemplateAVX (e, begin, end); });
+                    return;
                 }
             }
-
-            if constexpr (has::getSSE<Expression>)
+            else
             {
-                if (highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+                if (supportsAVX2)
                 {
-                    assignExpressionTemplateSSE4_1 (e);
+                    prepareAVX2 (e);
+                    forEachRange ([&] (size_t begin, size_t end) { assignExpressionTemplateAVX2 (e, begin, end); });
                     return;
                 }
             }
         }
 
-        const auto n = size();
+        if constexpr (has::getSSE<Expression>)
+        {
+            if (highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+            {
+                prepareSSE4_1 (e);
+                forEachRange ([&] (size_t begin, size_t end) { assignExpressionTemplateSSE4_1 (e, begin, end); });
+                return;
+            }
+        }
 
-        for (size_t i = 0; i < n; ++i)
-            storage[i] = e[i];
+        forEachRange ([&] (size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                storage[i] = e[i];
+        });
     }
 
     /** Used in assignment operators to figure out if we should attempt to move values from another container rather than copying. */
@@ -1058,123 +1155,265 @@ protected:
 
 private:
     //==============================================================================
+    // The prepare functions of the expressions are forced inline, so they have to be called from a function that
+    // targets the same instruction set
+    // clang-format off
+    template <class Expression> VCTR_TARGET ("avx512f") static void prepareAVX512 (const Expression& e) { e.prepareAVX512Evaluation(); }
+    template <class Expression> VCTR_TARGET ("avx")     static void prepareAVX    (const Expression& e) { e.prepareAVXEvaluation(); }
+    template <class Expression> VCTR_TARGET ("avx2")    static void prepareAVX2   (const Expression& e) { e.prepareAVXEvaluation(); }
+    template <class Expression> VCTR_TARGET ("sse4.1")  static void prepareSSE4_1 (const Expression& e) { e.prepareSSEEvaluation(); }
+    // clang-format on
+
     template <class Expression>
-    void assignExpressionTemplateNeon (const Expression& e)
+    void assignExpressionTemplateNeon (const Expression& e, size_t begin, size_t end)
     requires archARM
     {
         constexpr auto inc = NeonRegister<ElementType>::numElements;
-        const bool hasExtendedSIMDStorage = e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
-        const auto n = storage.size();
+        const bool hasExtendedSIMDStorage = end == size() && e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
+        const auto n = end - begin;
         const auto nSIMD = hasExtendedSIMDStorage ? detail::nextMultipleOf<inc> (n) : detail::previousMultipleOf<inc> (n);
 
-        e.prepareNeonEvaluation();
-        auto* d = data();
+        auto* d = data() + begin;
+
+        // See assignExpressionTemplateAVX512 for the overlapping tail
+        const bool useOverlappingTail = nSIMD < n && n >= inc;
+        NeonRegister<ElementType> tail {};
+
+        if (useOverlappingTail)
+            tail = e.getNeon (end - inc);
 
         size_t i = 0;
         for (; i < nSIMD; i += inc, d += inc)
-            e.getNeon (i).store (d);
+            e.getNeon (begin + i).store (d);
 
-        for (; i < n; ++i, ++d)
-            storage[i] = e[i];
+        if (useOverlappingTail)
+        {
+            tail.store (data() + end - inc);
+            return;
+        }
+
+        for (; i < n; ++i)
+            storage[begin + i] = e[begin + i];
+    }
+
+    template <class Expression>
+    VCTR_TARGET ("avx512f")
+    void assignExpressionTemplateAVX512 (const Expression& e, size_t begin, size_t end)
+    requires archX64
+    {
+        constexpr auto inc = AVX512Register<ElementType>::numElements;
+        const bool hasExtendedSIMDStorage = end == size() && e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
+        const auto n = end - begin;
+
+        auto* d = data() + begin;
+
+        // If the destination is not aligned, the elements up to the first aligned address are computed by an overlapping
+        // head register starting at the first element, so that all following registers can be stored aligned. Like the
+        // tail, it is evaluated before and stored after the main loop.
+        const auto numHeadElements = StorageInfoType::dataIsSIMDAligned || hasExtendedSIMDStorage || n < inc ? size_t (0) : detail::numElementsUntilAligned<sizeof (AVX512Register<ElementType>)> (d);
+        const auto nSIMD = hasExtendedSIMDStorage ? detail::nextMultipleOf<inc> (n) : numHeadElements + detail::previousMultipleOf<inc> (n - numHeadElements);
+        const bool useAlignedStores = StorageInfoType::dataIsSIMDAligned || detail::isAligned<sizeof (AVX512Register<ElementType>)> (d + numHeadElements);
+
+        // Remaining elements are computed by a final register that overlaps with the last full one. It is evaluated
+        // before the main loop, so that it still sees the unmodified source values if the expression is evaluated in place.
+        const bool useOverlappingHead = numHeadElements > 0;
+        const bool useOverlappingTail = nSIMD < n && n >= inc;
+        AVX512Register<ElementType> head {};
+        AVX512Register<ElementType> tail {};
+
+        if (useOverlappingHead)
+            head = e.getAVX512 (begin);
+
+        if (useOverlappingTail)
+            tail = e.getAVX512 (end - inc);
+
+        size_t i = numHeadElements;
+        d += numHeadElements;
+
+        if (useAlignedStores)
+        {
+            for (; i < nSIMD; i += inc, d += inc)
+                e.getAVX512 (begin + i).storeAligned (d);
+        }
+        else
+        {
+            for (; i < nSIMD; i += inc, d += inc)
+                e.getAVX512 (begin + i).storeUnaligned (d);
+        }
+
+        if (useOverlappingHead)
+            head.storeUnaligned (data() + begin);
+
+        if (useOverlappingTail)
+        {
+            tail.storeUnaligned (data() + end - inc);
+            return;
+        }
+
+        for (; i < n; ++i)
+            storage[begin + i] = e[begin + i];
     }
 
     template <class Expression>
     VCTR_TARGET ("avx2")
-    void assignExpressionTemplateAVX2 (const Expression& e)
+    void assignExpressionTemplateAVX2 (const Expression& e, size_t begin, size_t end)
     requires archX64
     {
         constexpr auto inc = AVXRegister<ElementType>::numElements;
-        const bool hasExtendedSIMDStorage = e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
-        const auto n = storage.size();
-        const auto nSIMD = hasExtendedSIMDStorage ? detail::nextMultipleOf<inc> (n) : detail::previousMultipleOf<inc> (n);
+        const bool hasExtendedSIMDStorage = end == size() && e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
+        const auto n = end - begin;
+
+        auto* d = data() + begin;
+
+        // See assignExpressionTemplateAVX512 for the overlapping head and tail
+        const auto numHeadElements = StorageInfoType::dataIsSIMDAligned || hasExtendedSIMDStorage || n < inc ? size_t (0) : detail::numElementsUntilAligned<sizeof (AVXRegister<ElementType>)> (d);
+        const auto nSIMD = hasExtendedSIMDStorage ? detail::nextMultipleOf<inc> (n) : numHeadElements + detail::previousMultipleOf<inc> (n - numHeadElements);
+        const bool useAlignedStores = StorageInfoType::dataIsSIMDAligned || detail::isAligned<sizeof (AVXRegister<ElementType>)> (d + numHeadElements);
+
+        const bool useOverlappingHead = numHeadElements > 0;
+        const bool useOverlappingTail = nSIMD < n && n >= inc;
+        AVXRegister<ElementType> head {};
+        AVXRegister<ElementType> tail {};
 
-        e.prepareAVXEvaluation();
-        auto* d = data();
+        if (useOverlappingHead)
+            head = e.getAVX (begin);
 
-        if (StorageInfoType::dataIsSIMDAligned)
+        if (useOverlappingTail)
+            tail = e.getAVX (end - inc);
+
+        size_t i = numHeadElements;
+        d += numHeadElements;
+
+        if (useAlignedStores)
         {
-            size_t i = 0;
             for (; i < nSIMD; i += inc, d += inc)
-                e.getAVX (i).storeAligned (d);
-
-            for (; i < n; ++i, ++d)
-                storage[i] = e[i];
+                e.getAVX (begin + i).storeAligned (d);
         }
         else
         {
-            size_t i = 0;
             for (; i < nSIMD; i += inc, d += inc)
-                e.getAVX (i).storeUnaligned (d);
+                e.getAVX (begin + i).storeUnaligned (d);
+        }
 
-            for (; i < n; ++i, ++d)
-                storage[i] = e[i];
+        if (useOverlappingHead)
+            head.storeUnaligned (data() + begin);
+
+        if (useOverlappingTail)
+        {
+            tail.storeUnaligned (data() + end - inc);
+            return;
         }
+
+        for (; i < n; ++i)
+            storage[begin + i] = e[begin + i];
     }
 
     template <class Expression>
     VCTR_TARGET ("avx")
-    void assignExpressionTemplateAVX (const Expression& e)
+    void assignExpressionTemplateAVX (const Expression& e, size_t begin, size_t end)
     requires archX64
     {
         constexpr auto inc = AVXRegister<ElementType>::numElements;
-        const bool hasExtendedSIMDStorage = e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
-        const auto n = storage.size();
-        const auto nSIMD = hasExtendedSIMDStorage ? detail::nextMultipleOf<inc> (n) : detail::previousMultipleOf<inc> (n);
+        const bool hasExtendedSIMDStorage = end == size() && e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
+        const auto n = end - begin;
+
+        auto* d = data() + begin;
+
+        // See assignExpressionTemplateAVX512 for the overlapping head and tail
+        const auto numHeadElements = StorageInfoType::dataIsSIMDAligned || hasExtendedSIMDStorage || n < inc ? size_t (0) : detail::numElementsUntilAligned<sizeof (AVXRegister<ElementType>)> (d);
+        const auto nSIMD = hasExtendedSIMDStorage ? detail::nextMultipleOf<inc> (n) : numHeadElements + detail::previousMultipleOf<inc> (n - numHeadElements);
+        const bool useAlignedStores = StorageInfoType::dataIsSIMDAligned || detail::isAligned<sizeof (AVXRegister<ElementType>)> (d + numHeadElements);
+
+        const bool useOverlappingHead = numHeadElements > 0;
+        const bool useOverlappingTail = nSIMD < n && n >= inc;
+        AVXRegister<ElementType> head {};
+        AVXRegister<ElementType> tail {};
+
+        if (useOverlappingHead)
+            head = e.getAVX (begin);
 
-        e.prepareAVXEvaluation();
-        auto* d = data();
+        if (useOverlappingTail)
+            tail = e.getAVX (end - inc);
 
-        if (StorageInfoType::dataIsSIMDAligned)
+        size_t i = numHeadElements;
+        d += numHeadElements;
+
+        if (useAlignedStores)
         {
-            size_t i = 0;
             for (; i < nSIMD; i += inc, d += inc)
-                e.getAVX (i).storeAligned (d);
-
-            for (; i < n; ++i, ++d)
-                storage[i] = e[i];
+                e.getAVX (begin + i).storeAligned (d);
         }
         else
         {
-            size_t i = 0;
             for (; i < nSIMD; i += inc, d += inc)
-                e.getAVX (i).storeUnaligned (d);
+                e.getAVX (begin + i).storeUnaligned (d);
+        }
 
-            for (; i < n; ++i, ++d)
-                storage[i] = e[i];
+        if (useOverlappingHead)
+            head.storeUnaligned (data() + begin);
+
+        if (useOverlappingTail)
+        {
+            tail.storeUnaligned (data() + end - inc);
+            return;
         }
+
+        for (; i < n; ++i)
+            storage[begin + i] = e[begin + i];
     }
 
     template <class Expression>
     VCTR_TARGET ("sse4.1")
-    void assignExpressionTemplateSSE4_1 (const Expression& e)
+    void assignExpressionTemplateSSE4_1 (const Expression& e, size_t begin, size_t end)
     requires archX64
     {
         constexpr auto inc = SSERegister<ElementType>::numElements;
-        const bool hasExtendedSIMDStorage = e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
-        const auto n = storage.size();
-        const auto nSIMD = hasExtendedSIMDStorage ? detail::nextMultipleOf<inc> (n) : detail::previousMultipleOf<inc> (n);
+        const bool hasExtendedSIMDStorage = end == size() && e.getStorageInfo().hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage;
+        const auto n = end - begin;
+
+        auto* d = data() + begin;
+
+        // See assignExpressionTemplateAVX512 for the overlapping head and tail
+        const auto numHeadElements = StorageInfoType::dataIsSIMDAligned || hasExtendedSIMDStorage || n < inc ? size_t (0) : detail::numElementsUntilAligned<sizeof (SSERegister<ElementType>)> (d);
+        const auto nSIMD = hasExtendedSIMDStorage ? detail::nextMultipleOf<inc> (n) : numHeadElements + detail::previousMultipleOf<inc> (n - numHeadElements);
+        const bool useAlignedStores = StorageInfoType::dataIsSIMDAligned || detail::isAligned<sizeof (SSERegister<ElementType>)> (d + numHeadElements);
+
+        const bool useOverlappingHead = numHeadElements > 0;
+        const bool useOverlappingTail = nSIMD < n && n >= inc;
+        SSERegister<ElementType> head {};
+        SSERegister<ElementType> tail {};
+
+        if (useOverlappingHead)
+            head = e.getSSE (begin);
 
-        e.prepareSSEEvaluation();
-        auto* d = data();
+        if (useOverlappingTail)
+            tail = e.getSSE (end - inc);
 
-        if (StorageInfoType::dataIsSIMDAligned)
+        size_t i = numHeadElements;
+        d += numHeadElements;
+
+        if (useAlignedStores)
         {
-            size_t i = 0;
             for (; i < nSIMD; i += inc, d += inc)
-                e.getSSE (i).storeAligned (d);
-
-            for (; i < n; ++i, ++d)
-                storage[i] = e[i];
+                e.getSSE (begin + i).storeAligned (d);
         }
         else
         {
-            size_t i = 0;
             for (; i < nSIMD; i += inc, d += inc)
-                e.getSSE (i).storeUnaligned (d);
+                e.getSSE (begin + i).storeUnaligned (d);
+        }
 
-            for (; i < n; ++i, ++d)
-                storage[i] = e[i];
+        if (useOverlappingHead)
+            head.storeUnaligned (data() + begin);
+
+        if (useOverlappingTail)
+        {
+            tail.storeUnaligned (data() + end - inc);
+            return;
         }
+
+        for (; i < n; ++i)
+            storage[begin + i] = e[begin + i];
     }
 
     //==============================================================================
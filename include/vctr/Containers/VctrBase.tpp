@@ -111,6 +111,28 @@ constexpr void VctrBase<ElementType, StorageType, extent, StorageInfoType>::oper
     assignExpressionTemplate (*this - c);
 }
 
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+constexpr size_t VctrBase<ElementType, StorageType, extent, StorageInfoType>::indexOfMaxElement() const
+requires std::totally_ordered<value_type>
+{
+    // Reducing an empty source is not allowed
+    if (empty())
+        return 0;
+
+    return vctr::indexOfMax << *this;
+}
+
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+constexpr size_t VctrBase<ElementType, StorageType, extent, StorageInfoType>::indexOfMinElement() const
+requires std::totally_ordered<value_type>
+{
+    // Reducing an empty source is not allowed
+    if (empty())
+        return 0;
+
+    return vctr::indexOfMin << *this;
+}
+
 template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
 constexpr ElementType VctrBase<ElementType, StorageType, extent, StorageInfoType>::min() const
 requires std::totally_ordered<ElementType>
@@ -195,4 +217,39 @@ requires is::complexFloatNumber<ElementType>
     return any ([] (auto val) { return std::isnan (val.real()) || std::isnan (val.imag()); });
 }
 
+//==============================================================================
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+constexpr void VctrBase<ElementType, StorageType, extent, StorageInfoType>::sort()
+requires std::totally_ordered<value_type>
+{
+    if constexpr (detail::hasAcceleratedSort<value_type>)
+        detail::AcceleratedSort<value_type>::sort (data(), size());
+    else
+        std::sort (begin(), end());
+}
+
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+constexpr void VctrBase<ElementType, StorageType, extent, StorageInfoType>::nthElement (size_t n)
+requires std::totally_ordered<value_type>
+{
+    VCTR_ASSERT (n < size());
+
+    if constexpr (detail::hasAcceleratedSort<value_type>)
+        detail::AcceleratedSort<value_type>::nthElement (data(), size(), n);
+    else
+        std::nth_element (begin(), begin() + n, end());
+}
+
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+constexpr void VctrBase<ElementType, StorageType, extent, StorageInfoType>::partialSort (size_t numElements)
+requires std::totally_ordered<value_type>
+{
+    VCTR_ASSERT (numElements <= size());
+
+    if constexpr (detail::hasAcceleratedSort<value_type>)
+        detail::AcceleratedSort<value_type>::partialSort (data(), size(), numElements);
+    else
+        std::partial_sort (begin(), begin() + numElements, end());
+}
+
 } // namespace vctr
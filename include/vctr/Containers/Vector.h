@@ -31,8 +31,9 @@ struct DefaultVectorAllocator
     using DefaultVectorAllocatorType = std::allocator<ElementType>;
 };
 
-/** The default allocator choice for arithmetic types is an AlignedAllocator. */
-template <is::number ElementType>
+/** The default allocator choice for arithmetic types and 16 bit floating point types is an AlignedAllocator. */
+template <class ElementType>
+requires is::number<ElementType> || is::halfPrecisionFloat<ElementType>
 struct DefaultVectorAllocator<ElementType>
 {
     using DefaultVectorAllocatorType = AlignedAllocator<ElementType, Config::maxSIMDRegisterSize>;
@@ -71,6 +72,16 @@ using StdVectorType = typename StdVector<T, Allocator>::Type;
 
 } // namespace detail
 
+/** A tag type to select the Vector constructor that leaves the elements uninitialised. */
+struct Uninitialized {};
+
+/** Pass this to a Vector constructor to create a Vector with uninitialised elements, e.g. like
+    @code
+    Vector<float> v (numElements, vctr::uninitialized);
+    @endcode
+ */
+inline constexpr Uninitialized uninitialized {};
+
 /** The heap-allocated container type.
 
     Wraps a std::vector with a suitable Allocator. For arithmetic types, including
@@ -120,12 +131,34 @@ public:
     template <std::convertible_to<Allocator<ElementType>> Alloc>
     Vector (Alloc&& allocator) : Vctr (StdVectorType (allocator)) {}
 
-    /** Creates an uninitialised Vector of the desired size. */
+    /** Creates a Vector of the desired size with all elements value initialised. */
     constexpr Vector (size_t size) : Vctr (StdVectorType (size)) {}
 
+    /** Creates a Vector of the desired size without initialising the elements.
+
+        This only makes sense if all elements are overwritten before they are read, e.g. by assigning an expression.
+
+        @see resizeUninitialized
+     */
+    constexpr Vector (size_t size, Uninitialized)
+    requires std::is_trivially_default_constructible_v<ElementType>
+    {
+        resizeUninitialized (size);
+    }
+
     /** Creates a Vector with all elements initialised to initialValue of the desired size. */
     constexpr Vector (size_t size, ElementType initialValue) : Vctr (StdVectorType (size, initialValue)) {}
 
+    /** Creates a Vector of the desired size with all elements value initialised on the threads of pool.
+
+        @see resize (size_t, ThreadPool&)
+     */
+    Vector (size_t size, ThreadPool& pool)
+    requires detail::canGrowUninitialised<StdVectorType>
+    {
+        resize (size, pool);
+    }
+
     /** Creates a Vector from an initializer list. */
     constexpr Vector (std::initializer_list<ElementType> il) : Vctr (StdVectorType (il)) {}
 
@@ -308,6 +341,54 @@ public:
      */
     constexpr void resize (size_t i) { Vctr::storage.resize (i); }
 
+    /** Changes the size of this Vector like resize, but leaves new elements uninitialised.
+
+        This saves filling the new elements with zeros in case they are overwritten anyway before they are read, e.g.
+        when resizing a scratch buffer that an expression is assigned to afterwards. With the default allocator and the
+        NumaLocalVectorAllocator the new elements are really left uninitialised, other allocators value initialise them.
+     */
+    constexpr void resizeUninitialized (size_t i)
+    requires std::is_trivially_default_constructible_v<ElementType>
+    {
+        detail::resizeUninitialized (Vctr::storage, i);
+    }
+
+    /** Changes the size of this Vector and value initialises new elements on the threads of pool.
+
+        The new elements are initialised in chunks with the same boundaries that assignParallel uses. Used with an
+        allocator that does not touch the memory when allocating it, like the NumaLocalVectorAllocator, the memory pages
+        of each chunk are placed on the NUMA node of the thread that initialises it. Since the pool distributes the
+        chunks dynamically, a later parallel assignment is not guaranteed to evaluate a chunk on that same thread.
+
+        This is only available for allocators that can leave new elements uninitialised when growing the Vector, like
+        the default allocator and the NumaLocalVectorAllocator, since other allocators would value initialise them on
+        the calling thread first.
+     */
+    void resize (size_t newSize, ThreadPool& pool)
+    requires detail::canGrowUninitialised<StdVectorType>
+    {
+        constexpr auto chunkSize = Vctr::parallelChunkSize;
+
+        const auto oldSize = Vctr::size();
+
+        // Leaves the new elements uninitialised, they are value initialised in parallel below
+        detail::resizeUninitialized (Vctr::storage, newSize);
+
+        if (newSize <= oldSize)
+            return;
+
+        const auto firstChunk = oldSize / chunkSize;
+        const auto numChunks = (newSize + chunkSize - 1) / chunkSize - firstChunk;
+
+        pool.parallelFor (numChunks, [&] (size_t c)
+        {
+            const auto begin = std::max (oldSize, (firstChunk + c) * chunkSize);
+            const auto end = std::min (newSize, (firstChunk + c + 1) * chunkSize);
+
+            std::fill (Vctr::begin() + begin, Vctr::begin() + end, ElementType {});
+        });
+    }
+
     /** Pre-allocates memory for the given number of elements.
 
         This is a standard interface function forwarded to std::vector::reserve().
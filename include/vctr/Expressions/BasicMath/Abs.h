@@ -79,6 +79,27 @@ public:
         return src.getNeon (i); // unsigned integers are always positive
     }
 
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::CommonElement::isRealFloat)
+    {
+        static const auto avx512SignBit = Expression::AVX512::broadcast (typename Expression::CommonElement::Type (-0.0));
+
+        return Expression::AVX512::andNot (avx512SignBit, src.getAVX512 (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && (Expression::CommonElement::isInt32 || Expression::CommonElement::isInt64))
+    {
+        return Expression::AVX512::abs (src.getAVX512 (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::CommonElement::isUnsigned)
+    {
+        return src.getAVX512 (i); // unsigned integers are always positive
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
     requires (archX64 && has::getAVX<SrcType> && Expression::CommonElement::isRealFloat)
@@ -55,11 +55,44 @@ public:
     //==============================================================================
     VCTR_FORWARD_PREPARE_SIMD_EVALUATION_BINARY_EXPRESSION_MEMBER_FUNCTIONS (srcA, srcB)
 
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcAType> && has::getAVX512<SrcBType> && (Expression::CommonElement::isRealFloat || Expression::CommonElement::isInt))
+    {
+        if constexpr (Config::hasFMA && has::getAVX512Factors<SrcAType>)
+        {
+            const auto [a, b] = srcA.getAVX512Factors (i);
+            return Expression::AVX512::fma (a, b, srcB.getAVX512 (i));
+        }
+        else if constexpr (Config::hasFMA && has::getAVX512Factors<SrcBType>)
+        {
+            const auto [a, b] = srcB.getAVX512Factors (i);
+            return Expression::AVX512::fma (a, b, srcA.getAVX512 (i));
+        }
+        else
+        {
+            return Expression::AVX512::add (srcA.getAVX512 (i), srcB.getAVX512 (i));
+        }
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
     requires (archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::CommonElement::isRealFloat)
     {
-        return Expression::AVX::add (srcA.getAVX (i), srcB.getAVX (i));
+        if constexpr (Config::hasFMA && has::getAVXFactors<SrcAType>)
+        {
+            const auto [a, b] = srcA.getAVXFactors (i);
+            return Expression::AVX::fma (a, b, srcB.getAVX (i));
+        }
+        else if constexpr (Config::hasFMA && has::getAVXFactors<SrcBType>)
+        {
+            const auto [a, b] = srcB.getAVXFactors (i);
+            return Expression::AVX::fma (a, b, srcA.getAVX (i));
+        }
+        else
+        {
+            return Expression::AVX::add (srcA.getAVX (i), srcB.getAVX (i));
+        }
     }
 
     VCTR_FORCEDINLINE VCTR_TARGET ("avx2") AVXRegister<value_type> getAVX (size_t i) const
@@ -73,7 +106,20 @@ public:
     VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
     requires (archX64 && has::getSSE<SrcAType> && has::getSSE<SrcBType>)
     {
-        return Expression::SSE::add (srcA.getSSE (i), srcB.getSSE (i));
+        if constexpr (Config::hasFMA && has::getSSEFactors<SrcAType>)
+        {
+            const auto [a, b] = srcA.getSSEFactors (i);
+            return Expression::SSE::fma (a, b, srcB.getSSE (i));
+        }
+        else if constexpr (Config::hasFMA && has::getSSEFactors<SrcBType>)
+        {
+            const auto [a, b] = srcB.getSSEFactors (i);
+            return Expression::SSE::fma (a, b, srcA.getSSE (i));
+        }
+        else
+        {
+            return Expression::SSE::add (srcA.getSSE (i), srcB.getSSE (i));
+        }
     }
 };
 
@@ -107,6 +153,20 @@ public:
     }
 
     //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+        singleSIMD.avx512 = Expression::AVX512::broadcast (single);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && (Expression::CommonElement::isRealFloat || Expression::CommonElement::isInt))
+    {
+        return Expression::AVX512::add (singleSIMD.avx512, src.getAVX512 (i));
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE  VCTR_TARGET ("avx") void prepareAVXEvaluation() const
     requires has::prepareAVXEvaluation<SrcType> && Expression::CommonElement::isRealFloat
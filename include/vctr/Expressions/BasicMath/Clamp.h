@@ -93,6 +93,102 @@ public:
         return dst;
     }
 
+    //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        assertBoundsAreSet();
+        src.prepareAVX512Evaluation();
+        lowerBoundSIMD.avx512 = Expression::AVX512::broadcast (lowerBound);
+        upperBoundSIMD.avx512 = Expression::AVX512::broadcast (upperBound);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && (is::realFloatNumber<value_type> || is::int32Number<value_type>))
+    {
+        auto x = src.getAVX512 (i);
+
+        if constexpr (clampLow)
+            x = Expression::AVX512::max (lowerBoundSIMD.avx512, x);
+
+        if constexpr (clampHigh)
+            x = Expression::AVX512::min (upperBoundSIMD.avx512, x);
+
+        return x;
+    }
+
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
+    requires has::prepareAVXEvaluation<SrcType> && is::realFloatNumber<value_type>
+    {
+        assertBoundsAreSet();
+        src.prepareAVXEvaluation();
+        lowerBoundSIMD.avx = Expression::AVX::broadcast (lowerBound);
+        upperBoundSIMD.avx = Expression::AVX::broadcast (upperBound);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") void prepareAVXEvaluation() const
+    requires has::prepareAVXEvaluation<SrcType> && is::int32Number<value_type>
+    {
+        assertBoundsAreSet();
+        src.prepareAVXEvaluation();
+        lowerBoundSIMD.avx = Expression::AVX::broadcast (lowerBound);
+        upperBoundSIMD.avx = Expression::AVX::broadcast (upperBound);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>)
+    {
+        auto x = src.getAVX (i);
+
+        if constexpr (clampLow)
+            x = Expression::AVX::max (lowerBoundSIMD.avx, x);
+
+        if constexpr (clampHigh)
+            x = Expression::AVX::min (upperBoundSIMD.avx, x);
+
+        return x;
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && is::int32Number<value_type>)
+    {
+        auto x = src.getAVX (i);
+
+        if constexpr (clampLow)
+            x = Expression::AVX::max (lowerBoundSIMD.avx, x);
+
+        if constexpr (clampHigh)
+            x = Expression::AVX::min (upperBoundSIMD.avx, x);
+
+        return x;
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void prepareSSEEvaluation() const
+    requires has::prepareSSEEvaluation<SrcType>
+    {
+        assertBoundsAreSet();
+        src.prepareSSEEvaluation();
+        lowerBoundSIMD.sse = Expression::SSE::broadcast (lowerBound);
+        upperBoundSIMD.sse = Expression::SSE::broadcast (upperBound);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcType> && (is::realFloatNumber<value_type> || is::int32Number<value_type>))
+    {
+        auto x = src.getSSE (i);
+
+        if constexpr (clampLow)
+            x = Expression::SSE::max (lowerBoundSIMD.sse, x);
+
+        if constexpr (clampHigh)
+            x = Expression::SSE::min (upperBoundSIMD.sse, x);
+
+        return x;
+    }
+
 private:
     void assertBoundsAreSet() const
     {
@@ -107,6 +203,8 @@ private:
 
     value_type lowerBound = std::numeric_limits<value_type>::max();
     value_type upperBound = std::numeric_limits<value_type>::max();
+    mutable SIMDRegisterUnion<Expression> lowerBoundSIMD {};
+    mutable SIMDRegisterUnion<Expression> upperBoundSIMD {};
 };
 
 template <size_t extent, class SrcType>
@@ -181,6 +279,102 @@ public:
 
         return dst;
     }
+
+    //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+        lowerBoundSIMD.avx512 = Expression::AVX512::broadcast (lowerBound);
+        upperBoundSIMD.avx512 = Expression::AVX512::broadcast (upperBound);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && (is::realFloatNumber<value_type> || is::int32Number<value_type>))
+    {
+        auto x = src.getAVX512 (i);
+
+        if constexpr (clampLow)
+            x = Expression::AVX512::max (lowerBoundSIMD.avx512, x);
+
+        if constexpr (clampHigh)
+            x = Expression::AVX512::min (upperBoundSIMD.avx512, x);
+
+        return x;
+    }
+
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
+    requires has::prepareAVXEvaluation<SrcType> && is::realFloatNumber<value_type>
+    {
+        src.prepareAVXEvaluation();
+        lowerBoundSIMD.avx = Expression::AVX::broadcast (lowerBound);
+        upperBoundSIMD.avx = Expression::AVX::broadcast (upperBound);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") void prepareAVXEvaluation() const
+    requires has::prepareAVXEvaluation<SrcType> && is::int32Number<value_type>
+    {
+        src.prepareAVXEvaluation();
+        lowerBoundSIMD.avx = Expression::AVX::broadcast (lowerBound);
+        upperBoundSIMD.avx = Expression::AVX::broadcast (upperBound);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>)
+    {
+        auto x = src.getAVX (i);
+
+        if constexpr (clampLow)
+            x = Expression::AVX::max (lowerBoundSIMD.avx, x);
+
+        if constexpr (clampHigh)
+            x = Expression::AVX::min (upperBoundSIMD.avx, x);
+
+        return x;
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && is::int32Number<value_type>)
+    {
+        auto x = src.getAVX (i);
+
+        if constexpr (clampLow)
+            x = Expression::AVX::max (lowerBoundSIMD.avx, x);
+
+        if constexpr (clampHigh)
+            x = Expression::AVX::min (upperBoundSIMD.avx, x);
+
+        return x;
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void prepareSSEEvaluation() const
+    requires has::prepareSSEEvaluation<SrcType>
+    {
+        src.prepareSSEEvaluation();
+        lowerBoundSIMD.sse = Expression::SSE::broadcast (lowerBound);
+        upperBoundSIMD.sse = Expression::SSE::broadcast (upperBound);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcType> && (is::realFloatNumber<value_type> || is::int32Number<value_type>))
+    {
+        auto x = src.getSSE (i);
+
+        if constexpr (clampLow)
+            x = Expression::SSE::max (lowerBoundSIMD.sse, x);
+
+        if constexpr (clampHigh)
+            x = Expression::SSE::min (upperBoundSIMD.sse, x);
+
+        return x;
+    }
+
+private:
+    mutable SIMDRegisterUnion<Expression> lowerBoundSIMD {};
+    mutable SIMDRegisterUnion<Expression> upperBoundSIMD {};
 };
 
 } // namespace vctr::expressions
@@ -55,6 +55,13 @@ public:
     //==============================================================================
     VCTR_FORWARD_PREPARE_SIMD_EVALUATION_BINARY_EXPRESSION_MEMBER_FUNCTIONS (srcA, srcB)
 
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcAType> && has::getAVX512<SrcBType> && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX512::div (srcA.getAVX512 (i), srcB.getAVX512 (i));
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
     requires (archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::CommonElement::isRealFloat)
@@ -93,6 +100,20 @@ public:
     }
 
     //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+        singleSIMD.avx512 = Expression::AVX512::broadcast (single);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX512::div (singleSIMD.avx512, src.getAVX512 (i));
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
     requires has::prepareAVXEvaluation<SrcType>
@@ -155,6 +176,20 @@ public:
     }
 
     //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+        singleSIMD.avx512 = Expression::AVX512::broadcast (single);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX512::div (src.getAVX512 (i), singleSIMD.avx512);
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
     requires has::prepareAVXEvaluation<SrcType>
@@ -0,0 +1,424 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::detail
+{
+
+/** Computes complex dot products, optionally conjugating the elements of the second source. */
+template <class T, bool conjugateB>
+struct ComplexDotProduct
+{
+    VCTR_FORCEDINLINE static constexpr void multiplyAccumulate (std::complex<T>& result, std::complex<T> a, std::complex<T> b)
+    {
+        // The products are spelled out, since the complex multiplication operator handles inf and NaN edge cases at
+        // the cost of a function call per element with most compilers
+        const auto bImag = conjugateB ? -b.imag() : b.imag();
+
+        result = { result.real() + a.real() * b.real() - a.imag() * bImag,
+                   result.imag() + a.real() * bImag + a.imag() * b.real() };
+    }
+
+    /** Computes the dot product of two sources with contiguous memory, using the highest instruction set available. */
+    static std::complex<T> compute (const std::complex<T>* a, const std::complex<T>* b, size_t n)
+    {
+        if constexpr (Config::archX64)
+        {
+            if (Config::supportsAVX512)
+                return computeAVX512 (a, b, n);
+
+            if (Config::supportsAVX)
+                return computeAVX (a, b, n);
+
+            if (Config::highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+                return computeSSE (a, b, n);
+        }
+
+        std::complex<T> result {};
+
+        for (size_t i = 0; i < n; ++i)
+            multiplyAccumulate (result, a[i], b[i]);
+
+        return result;
+    }
+
+private:
+    /** Independent accumulators, which hide the latency of the multiply and add instructions. */
+    static constexpr size_t numAccumulators = 2;
+
+    //==============================================================================
+    // There are no SIMD registers holding complex values, so the interleaved real and imaginary parts are treated as
+    // real valued vectors. The products of a and b end up in one register, holding real * real products in the even
+    // and imag * imag products in the odd lanes. The products of a and b with the real and imaginary parts of b
+    // swapped end up in another one, holding real * imag products in the even and imag * real products in the odd
+    // lanes. Both are only combined into the real and imaginary part of the result by finalize. All functions that
+    // touch registers are implemented per instruction set, since they might not be inlined in debug builds.
+    VCTR_TARGET ("avx512f") static std::complex<T> computeAVX512 (const std::complex<T>* a, const std::complex<T>* b, size_t n)
+    {
+        using R = AVX512Register<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto* realA = reinterpret_cast<const T*> (a);
+        const auto* realB = reinterpret_cast<const T*> (b);
+        const auto simdEnd = previousMultipleOf<inc> (2 * n);
+
+        std::array<R, numAccumulators> products;
+        std::array<R, numAccumulators> swappedProducts;
+
+        for (size_t k = 0; k < numAccumulators; ++k)
+        {
+            products[k] = R::broadcast (T (0));
+            swappedProducts[k] = R::broadcast (T (0));
+        }
+
+        size_t i = 0;
+
+        for (; i + numAccumulators * inc <= simdEnd; i += numAccumulators * inc)
+            for (size_t k = 0; k < numAccumulators; ++k)
+                accumulateAVX512 (products[k], swappedProducts[k], realA + i + k * inc, realB + i + k * inc);
+
+        for (; i < simdEnd; i += inc)
+            accumulateAVX512 (products[0], swappedProducts[0], realA + i, realB + i);
+
+        for (size_t k = 1; k < numAccumulators; ++k)
+        {
+            products[0] = R::add (products[0], products[k]);
+            swappedProducts[0] = R::add (swappedProducts[0], swappedProducts[k]);
+        }
+
+        alignas (Config::maxSIMDRegisterSize) std::array<T, inc> productLanes;
+        alignas (Config::maxSIMDRegisterSize) std::array<T, inc> swappedProductLanes;
+        products[0].storeAligned (productLanes.data());
+        swappedProducts[0].storeAligned (swappedProductLanes.data());
+
+        return finalize (productLanes, swappedProductLanes, a, b, simdEnd / 2, n);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void accumulateAVX512 (AVX512Register<T>& products, AVX512Register<T>& swappedProducts, const T* a, const T* b)
+    {
+        using R = AVX512Register<T>;
+
+        const auto x = R::loadUnaligned (a);
+        const auto y = R::loadUnaligned (b);
+        const auto ySwapped = R::template swapAdjacentGroups<1> (y);
+
+        if constexpr (Config::hasFMA)
+        {
+            products = R::fma (x, y, products);
+            swappedProducts = R::fma (x, ySwapped, swappedProducts);
+        }
+        else
+        {
+            products = R::add (products, R::mul (x, y));
+            swappedProducts = R::add (swappedProducts, R::mul (x, ySwapped));
+        }
+    }
+
+    VCTR_TARGET ("avx") static std::complex<T> computeAVX (const std::complex<T>* a, const std::complex<T>* b, size_t n)
+    {
+        using R = AVXRegister<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto* realA = reinterpret_cast<const T*> (a);
+        const auto* realB = reinterpret_cast<const T*> (b);
+        const auto simdEnd = previousMultipleOf<inc> (2 * n);
+
+        std::array<R, numAccumulators> products;
+        std::array<R, numAccumulators> swappedProducts;
+
+        for (size_t k = 0; k < numAccumulators; ++k)
+        {
+            products[k] = R::broadcast (T (0));
+            swappedProducts[k] = R::broadcast (T (0));
+        }
+
+        size_t i = 0;
+
+        for (; i + numAccumulators * inc <= simdEnd; i += numAccumulators * inc)
+            for (size_t k = 0; k < numAccumulators; ++k)
+                accumulateAVX (products[k], swappedProducts[k], realA + i + k * inc, realB + i + k * inc);
+
+        for (; i < simdEnd; i += inc)
+            accumulateAVX (products[0], swappedProducts[0], realA + i, realB + i);
+
+        for (size_t k = 1; k < numAccumulators; ++k)
+        {
+            products[0] = R::add (products[0], products[k]);
+            swappedProducts[0] = R::add (swappedProducts[0], swappedProducts[k]);
+        }
+
+        alignas (Config::maxSIMDRegisterSize) std::array<T, inc> productLanes;
+        alignas (Config::maxSIMDRegisterSize) std::array<T, inc> swappedProductLanes;
+        products[0].storeAligned (productLanes.data());
+        swappedProducts[0].storeAligned (swappedProductLanes.data());
+
+        return finalize (productLanes, swappedProductLanes, a, b, simdEnd / 2, n);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") static void accumulateAVX (AVXRegister<T>& products, AVXRegister<T>& swappedProducts, const T* a, const T* b)
+    {
+        using R = AVXRegister<T>;
+
+        const auto x = R::loadUnaligned (a);
+        const auto y = R::loadUnaligned (b);
+        const auto ySwapped = R::template swapAdjacentGroups<1> (y);
+
+        if constexpr (Config::hasFMA)
+        {
+            products = R::fma (x, y, products);
+            swappedProducts = R::fma (x, ySwapped, swappedProducts);
+        }
+        else
+        {
+            products = R::add (products, R::mul (x, y));
+            swappedProducts = R::add (swappedProducts, R::mul (x, ySwapped));
+        }
+    }
+
+    VCTR_TARGET ("sse4.1") static std::complex<T> computeSSE (const std::complex<T>* a, const std::complex<T>* b, size_t n)
+    {
+        using R = SSERegister<T>;
+        constexpr auto inc = R::numElements;
+
+        const auto* realA = reinterpret_cast<const T*> (a);
+        const auto* realB = reinterpret_cast<const T*> (b);
+        const auto simdEnd = previousMultipleOf<inc> (2 * n);
+
+        std::array<R, numAccumulators> products;
+        std::array<R, numAccumulators> swappedProducts;
+
+        for (size_t k = 0; k < numAccumulators; ++k)
+        {
+            products[k] = R::broadcast (T (0));
+            swappedProducts[k] = R::broadcast (T (0));
+        }
+
+        size_t i = 0;
+
+        for (; i + numAccumulators * inc <= simdEnd; i += numAccumulators * inc)
+            for (size_t k = 0; k < numAccumulators; ++k)
+                accumulateSSE (products[k], swappedProducts[k], realA + i + k * inc, realB + i + k * inc);
+
+        for (; i < simdEnd; i += inc)
+            accumulateSSE (products[0], swappedProducts[0], realA + i, realB + i);
+
+        for (size_t k = 1; k < numAccumulators; ++k)
+        {
+            products[0] = R::add (products[0], products[k]);
+            swappedProducts[0] = R::add (swappedProducts[0], swappedProducts[k]);
+        }
+
+        alignas (Config::maxSIMDRegisterSize) std::array<T, inc> productLanes;
+        alignas (Config::maxSIMDRegisterSize) std::array<T, inc> swappedProductLanes;
+        products[0].storeAligned (productLanes.data());
+        swappedProducts[0].storeAligned (swappedProductLanes.data());
+
+        return finalize (productLanes, swappedProductLanes, a, b, simdEnd / 2, n);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") static void accumulateSSE (SSERegister<T>& products, SSERegister<T>& swappedProducts, const T* a, const T* b)
+    {
+        using R = SSERegister<T>;
+
+        const auto x = R::loadUnaligned (a);
+        const auto y = R::loadUnaligned (b);
+        const auto ySwapped = R::template swapAdjacentGroups<1> (y);
+
+        if constexpr (Config::hasFMA)
+        {
+            products = R::fma (x, y, products);
+            swappedProducts = R::fma (x, ySwapped, swappedProducts);
+        }
+        else
+        {
+            products = R::add (products, R::mul (x, y));
+            swappedProducts = R::add (swappedProducts, R::mul (x, ySwapped));
+        }
+    }
+
+    //==============================================================================
+    /** Combines the accumulator lanes into the result and adds the products of the remaining elements from begin to n. */
+    template <size_t numLanes>
+    static std::complex<T> finalize (const std::array<T, numLanes>& productLanes, const std::array<T, numLanes>& swappedProductLanes, const std::complex<T>* a, const std::complex<T>* b, size_t begin, size_t n)
+    {
+        T real = 0;
+        T imag = 0;
+
+        for (size_t lane = 0; lane < numLanes; lane += 2)
+        {
+            real += conjugateB ? productLanes[lane] + productLanes[lane + 1] : productLanes[lane] - productLanes[lane + 1];
+            imag += conjugateB ? swappedProductLanes[lane + 1] - swappedProductLanes[lane] : swappedProductLanes[lane] + swappedProductLanes[lane + 1];
+        }
+
+        std::complex<T> result (real, imag);
+
+        for (auto i = begin; i < n; ++i)
+            multiplyAccumulate (result, a[i], b[i]);
+
+        return result;
+    }
+};
+
+} // namespace vctr::detail
+
+namespace vctr::expressions
+{
+
+/** Sums up the products of two vector like types, optionally conjugating the elements of the second one. */
+template <size_t extent, class SrcAType, class SrcBType, bool conjugateB>
+class DotProduct : public ExpressionTemplateBase
+{
+public:
+    using value_type = std::common_type_t<ValueType<SrcAType>, ValueType<SrcBType>>;
+
+    VCTR_COMMON_BINARY_VEC_VEC_EXPRESSION_MEMBERS (DotProduct, srcA, srcB)
+
+    static constexpr value_type reductionResultInitValue = 0;
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    requires is::complexFloatNumber<value_type>
+    {
+        detail::ComplexDotProduct<RealType<value_type>, conjugateB>::multiplyAccumulate (result, srcA[i], srcB[i]);
+    }
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    requires (! is::complexFloatNumber<value_type>)
+    {
+        result += srcA[i] * srcB[i];
+    }
+
+    //==============================================================================
+private:
+    static constexpr bool accelerateSuitable = is::suitableForAccelerateRealOrComplexFloatVectorReductionOp<SrcAType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> && has::data<SrcBType> && Expression::allElementTypesSame;
+
+    // IPP has no complex dot product that conjugates the elements of the second source
+    static constexpr bool ippSuitable = is::suitableForIppRealOrComplexFloatVectorReductionOp<SrcAType, value_type, detail::preferIfIppAndAccelerateAreAvailable> && has::data<SrcBType> && Expression::allElementTypesSame && ! (conjugateB && is::complexFloatNumber<value_type>);
+
+public:
+    VCTR_FORCEDINLINE value_type reduceVectorOp() const
+    requires accelerateSuitable
+    {
+        if constexpr (conjugateB && is::complexFloatNumber<value_type>)
+            return Expression::Accelerate::innerProduct (srcA.data(), srcB.data(), size());
+        else
+            return Expression::Accelerate::dotProduct (srcA.data(), srcB.data(), size());
+    };
+
+    VCTR_FORCEDINLINE value_type reduceVectorOp() const
+    requires ippSuitable
+    {
+        return Expression::IPP::dotProduct (srcA.data(), srcB.data(), sizeToInt (size()));
+    };
+
+    // Complex sources with contiguous memory are reduced by dedicated SIMD implementations if no platform vector
+    // operation is suitable, since there are no SIMD registers holding complex values that the register wise
+    // reduction could use
+    VCTR_FORCEDINLINE value_type reduceVectorOp() const
+    requires Config::archX64 && is::complexFloatNumber<value_type> && has::data<SrcAType> && has::data<SrcBType> && Expression::allElementTypesSame && (! accelerateSuitable) && (! ippSuitable)
+    {
+        return detail::ComplexDotProduct<RealType<value_type>, conjugateB>::compute (srcA.data(), srcB.data(), size());
+    };
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_BINARY_EXPRESSION_MEMBER_FUNCTIONS (srcA, srcB)
+
+    VCTR_FORCEDINLINE void reduceNeonRegisterWise (NeonRegister<value_type>& result, size_t i) const
+    requires Config::archARM && has::getNeon<SrcAType> && has::getNeon<SrcBType> && Expression::allElementTypesSame && is::realFloatNumber<value_type>
+    {
+        result = Expression::Neon::add (result, Expression::Neon::mul (srcA.getNeon (i), srcB.getNeon (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcAType> && has::getAVX512<SrcBType> && Expression::allElementTypesSame && is::realFloatNumber<value_type>
+    {
+        if constexpr (Config::hasFMA)
+            result = Expression::AVX512::fma (srcA.getAVX512 (i), srcB.getAVX512 (i), result);
+        else
+            result = Expression::AVX512::add (result, Expression::AVX512::mul (srcA.getAVX512 (i), srcB.getAVX512 (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::allElementTypesSame && is::realFloatNumber<value_type>
+    {
+        if constexpr (Config::hasFMA)
+            result = Expression::AVX::fma (srcA.getAVX (i), srcB.getAVX (i), result);
+        else
+            result = Expression::AVX::add (result, Expression::AVX::mul (srcA.getAVX (i), srcB.getAVX (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (SSERegister<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcAType> && has::getSSE<SrcBType> && Expression::allElementTypesSame && is::realFloatNumber<value_type>
+    {
+        if constexpr (Config::hasFMA)
+            result = Expression::SSE::fma (srcA.getSSE (i), srcB.getSSE (i), result);
+        else
+            result = Expression::SSE::add (result, Expression::SSE::mul (srcA.getSSE (i), srcB.getSSE (i)));
+    }
+
+    //==============================================================================
+    template <size_t n>
+    VCTR_FORCEDINLINE static constexpr value_type finalizeReduction (const std::array<value_type, n>& sums)
+    {
+        if constexpr (n == 1)
+            return sums[0];
+
+        return std::reduce (sums.begin(), sums.end());
+    }
+};
+
+} // namespace vctr::expressions
+
+namespace vctr
+{
+
+/** Returns the dot product of vector or expression a and vector or expression b, which is the sum of all products
+    a[i] * b[i].
+
+    @ingroup Expressions
+ */
+template <class SrcAType, class SrcBType>
+requires (is::anyVctrOrExpression<std::remove_cvref_t<SrcAType>> &&
+          is::anyVctrOrExpression<std::remove_cvref_t<SrcBType>>)
+constexpr auto dotProduct (SrcAType&& a, SrcBType&& b)
+{
+    assertCommonSize (a, b);
+    constexpr auto extent = getCommonExtent<SrcAType, SrcBType>();
+
+    return ReductionExpression::reduce (expressions::DotProduct<extent, SrcAType, SrcBType, false> (std::forward<SrcAType> (a), std::forward<SrcBType> (b)));
+}
+
+/** Returns the inner product of vector or expression a and vector or expression b, which is the sum of all products
+    a[i] * conj (b[i]). For real valued sources, this is the same as the dot product.
+
+    @ingroup Expressions
+ */
+template <class SrcAType, class SrcBType>
+requires (is::anyVctrOrExpression<std::remove_cvref_t<SrcAType>> &&
+          is::anyVctrOrExpression<std::remove_cvref_t<SrcBType>>)
+constexpr auto innerProduct (SrcAType&& a, SrcBType&& b)
+{
+    assertCommonSize (a, b);
+    constexpr auto extent = getCommonExtent<SrcAType, SrcBType>();
+
+    return ReductionExpression::reduce (expressions::DotProduct<extent, SrcAType, SrcBType, true> (std::forward<SrcAType> (a), std::forward<SrcBType> (b)));
+}
+
+} // namespace vctr
@@ -61,6 +61,12 @@ public:
         result = Expression::Neon::max (result, src.getNeon (i));
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && (is::realFloatNumber<value_type> || is::int32Number<value_type>)
+    {
+        result = Expression::AVX512::max (result, src.getAVX512 (i));
+    }
+
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
     requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>
     {
@@ -115,7 +121,13 @@ public:
 
     //==============================================================================
     VCTR_FORCEDINLINE value_type reduceVectorOp() const
-    requires is::suitableForIppRealFloatVectorReductionOp<SrcType, value_type>
+    requires is::suitableForAccelerateRealFloatVectorReductionOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> && Expression::allElementTypesSame
+    {
+        return Expression::Accelerate::maxAbs (src.data(), size());
+    };
+
+    VCTR_FORCEDINLINE value_type reduceVectorOp() const
+    requires is::suitableForIppRealFloatVectorReductionOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable> && Expression::allElementTypesSame
     {
         return Expression::IPP::maxAbs (src.data(), sizeToInt (size()));
     };
@@ -135,10 +147,30 @@ public:
         result = Expression::Neon::max (result, src.getNeon (i));
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<value_type>
+    {
+        const auto avx512SignBit = Expression::AVX512::broadcast (typename Expression::CommonElement::Type (-0.0));
+
+        result = Expression::AVX512::max (result, Expression::AVX512::andNot (avx512SignBit, src.getAVX512 (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && std::same_as<int32_t, value_type>
+    {
+        result = Expression::AVX512::max (result, Expression::AVX512::abs (src.getAVX512 (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && std::same_as<uint32_t, value_type>
+    {
+        result = Expression::AVX512::max (result, src.getAVX512 (i));
+    }
+
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
     requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>
     {
-        static const auto avxSignBit = Expression::AVX::broadcast (typename Expression::CommonElement::Type (-0.0));
+        const auto avxSignBit = Expression::AVX::broadcast (typename Expression::CommonElement::Type (-0.0));
 
         result = Expression::AVX::max (result, Expression::AVX::andNot (avxSignBit, src.getAVX (i)));
     }
@@ -158,7 +190,7 @@ public:
     VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (SSERegister<value_type>& result, size_t i) const
     requires Config::archX64 && has::getSSE<SrcType> && is::realFloatNumber<value_type>
     {
-        static const auto sseSignBit = Expression::SSE::broadcast (typename Expression::CommonElement::Type (-0.0));
+        const auto sseSignBit = Expression::SSE::broadcast (typename Expression::CommonElement::Type (-0.0));
 
         result = Expression::SSE::max (result, Expression::SSE::andNot (sseSignBit, src.getSSE (i)));
     }
@@ -186,6 +218,145 @@ public:
     }
 };
 
+template <size_t extent, class SrcType>
+requires std::totally_ordered<ValueType<SrcType>>
+class IndexOfMax : public ExpressionTemplateBase
+{
+public:
+    using value_type = size_t;
+    using SrcValueType = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (IndexOfMax, src)
+
+    static constexpr value_type reductionResultInitValue = 0;
+
+    /** The value that each lane starts with in register wise index reductions. */
+    static constexpr SrcValueType indexReductionInitValue = std::numeric_limits<SrcValueType>::lowest();
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    {
+        if (src[i] > src[result])
+            result = i;
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    // The lanes of registerIndices hold the index of the register that the value in the corresponding lane of values
+    // was found in. Only greater values replace the previous ones, so that the first maximum of each lane is kept.
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<SrcValueType>& values, AVX512Register<SrcValueType>& registerIndices, AVX512Register<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto x = src.getAVX512 (i);
+        const auto isGreater = Expression::AVX512Src::greaterThan (x, values);
+
+        values = Expression::AVX512Src::select (isGreater, x, values);
+        registerIndices = Expression::AVX512Src::select (isGreater, registerIndex, registerIndices);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<SrcValueType>& values, AVXRegister<SrcValueType>& registerIndices, AVXRegister<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto x = src.getAVX (i);
+        const auto isGreater = Expression::AVXSrc::greaterThan (x, values);
+
+        values = Expression::AVXSrc::select (isGreater, x, values);
+        registerIndices = Expression::AVXSrc::select (isGreater, registerIndex, registerIndices);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (SSERegister<SrcValueType>& values, SSERegister<SrcValueType>& registerIndices, SSERegister<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto x = src.getSSE (i);
+        const auto isGreater = Expression::SSESrc::greaterThan (x, values);
+
+        values = Expression::SSESrc::select (isGreater, x, values);
+        registerIndices = Expression::SSESrc::select (isGreater, registerIndex, registerIndices);
+    }
+
+    //==============================================================================
+    VCTR_FORCEDINLINE static constexpr value_type finalizeReduction (const std::array<value_type, 1>& index)
+    {
+        return index[0];
+    }
+};
+
+template <size_t extent, class SrcType>
+requires is::number<ValueType<SrcType>>
+class IndexOfMaxAbs : public ExpressionTemplateBase
+{
+public:
+    using value_type = size_t;
+    using SrcValueType = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (IndexOfMaxAbs, src)
+
+    static constexpr value_type reductionResultInitValue = 0;
+
+    /** The value that each lane starts with in register wise index reductions. */
+    static constexpr SrcValueType indexReductionInitValue = 0;
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    requires is::signedNumber<RealType<SrcValueType>>
+    {
+        if (std::abs (src[i]) > std::abs (src[result]))
+            result = i;
+    }
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    requires (! is::signedNumber<RealType<SrcValueType>>)
+    {
+        if (src[i] > src[result])
+            result = i;
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    // See IndexOfMax for the register indices
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<SrcValueType>& values, AVX512Register<SrcValueType>& registerIndices, AVX512Register<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto avx512SignBit = Expression::AVX512Src::broadcast (SrcValueType (-0.0));
+
+        const auto x = Expression::AVX512Src::andNot (avx512SignBit, src.getAVX512 (i));
+        const auto isGreater = Expression::AVX512Src::greaterThan (x, values);
+
+        values = Expression::AVX512Src::select (isGreater, x, values);
+        registerIndices = Expression::AVX512Src::select (isGreater, registerIndex, registerIndices);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<SrcValueType>& values, AVXRegister<SrcValueType>& registerIndices, AVXRegister<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto avxSignBit = Expression::AVXSrc::broadcast (SrcValueType (-0.0));
+
+        const auto x = Expression::AVXSrc::andNot (avxSignBit, src.getAVX (i));
+        const auto isGreater = Expression::AVXSrc::greaterThan (x, values);
+
+        values = Expression::AVXSrc::select (isGreater, x, values);
+        registerIndices = Expression::AVXSrc::select (isGreater, registerIndex, registerIndices);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (SSERegister<SrcValueType>& values, SSERegister<SrcValueType>& registerIndices, SSERegister<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto sseSignBit = Expression::SSESrc::broadcast (SrcValueType (-0.0));
+
+        const auto x = Expression::SSESrc::andNot (sseSignBit, src.getSSE (i));
+        const auto isGreater = Expression::SSESrc::greaterThan (x, values);
+
+        values = Expression::SSESrc::select (isGreater, x, values);
+        registerIndices = Expression::SSESrc::select (isGreater, registerIndex, registerIndices);
+    }
+
+    //==============================================================================
+    VCTR_FORCEDINLINE static constexpr value_type finalizeReduction (const std::array<value_type, 1>& index)
+    {
+        return index[0];
+    }
+};
+
 } // namespace vctr::expressions
 
 namespace vctr
@@ -203,4 +374,22 @@ constexpr inline ExpressionChainBuilder<expressions::Max> max;
  */
 constexpr inline ExpressionChainBuilder<expressions::MaxAbs> maxAbs;
 
+/** Computes the index of the first maximum value of the source values (aka argMax).
+
+    The result is unspecified if the source values contain NaN. Only sources with real floating point values are
+    reduced with SIMD registers, all other sources, including integers, are reduced element wise.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::IndexOfMax> indexOfMax;
+
+/** Computes the index of the first maximum absolute value of the source values.
+
+    The result is unspecified if the source values contain NaN. Only sources with real floating point values are
+    reduced with SIMD registers, all other sources, including integers, are reduced element wise.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::IndexOfMaxAbs> indexOfMaxAbs;
+
 } // namespace vctr
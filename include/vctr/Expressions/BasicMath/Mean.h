@@ -61,6 +61,12 @@ public:
         result = Expression::Neon::add (result, src.getNeon (i));
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && (is::realFloatNumber<value_type> || is::int32Number<value_type>)
+    {
+        result = Expression::AVX512::add (result, src.getAVX512 (i));
+    }
+
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
     requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>
     {
@@ -131,6 +137,14 @@ public:
         result = Expression::Neon::add (result, s);
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<value_type>
+    {
+        auto s = src.getAVX512 (i);
+        s = Expression::AVX512::mul (s, s);
+        result = Expression::AVX512::add (result, s);
+    }
+
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
     requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>
     {
@@ -199,6 +213,14 @@ public:
         result = Expression::Neon::add (result, s);
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<value_type>
+    {
+        auto s = src.getAVX512 (i);
+        s = Expression::AVX512::mul (s, s);
+        result = Expression::AVX512::add (result, s);
+    }
+
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
     requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>
     {
@@ -61,6 +61,12 @@ public:
         result = Expression::Neon::min (result, src.getNeon (i));
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && (is::realFloatNumber<value_type> || is::int32Number<value_type>)
+    {
+        result = Expression::AVX512::min (result, src.getAVX512 (i));
+    }
+
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
     requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>
     {
@@ -135,6 +141,26 @@ public:
         result = Expression::Neon::min (result, src.getNeon (i));
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<value_type>
+    {
+        static const auto avx512SignBit = Expression::AVX512::broadcast (typename Expression::CommonElement::Type (-0.0));
+
+        result = Expression::AVX512::min (result, Expression::AVX512::andNot (avx512SignBit, src.getAVX512 (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && std::same_as<int32_t, value_type>
+    {
+        result = Expression::AVX512::min (result, Expression::AVX512::abs (src.getAVX512 (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && std::same_as<uint32_t, value_type>
+    {
+        result = Expression::AVX512::min (result, src.getAVX512 (i));
+    }
+
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
     requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<value_type>
     {
@@ -186,6 +212,68 @@ public:
     }
 };
 
+template <size_t extent, class SrcType>
+requires std::totally_ordered<ValueType<SrcType>>
+class IndexOfMin : public ExpressionTemplateBase
+{
+public:
+    using value_type = size_t;
+    using SrcValueType = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (IndexOfMin, src)
+
+    static constexpr value_type reductionResultInitValue = 0;
+
+    /** The value that each lane starts with in register wise index reductions. */
+    static constexpr SrcValueType indexReductionInitValue = std::numeric_limits<SrcValueType>::max();
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    {
+        if (src[i] < src[result])
+            result = i;
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    // See IndexOfMax for the register indices
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<SrcValueType>& values, AVX512Register<SrcValueType>& registerIndices, AVX512Register<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto x = src.getAVX512 (i);
+        const auto isLess = Expression::AVX512Src::lessThan (x, values);
+
+        values = Expression::AVX512Src::select (isLess, x, values);
+        registerIndices = Expression::AVX512Src::select (isLess, registerIndex, registerIndices);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<SrcValueType>& values, AVXRegister<SrcValueType>& registerIndices, AVXRegister<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto x = src.getAVX (i);
+        const auto isLess = Expression::AVXSrc::lessThan (x, values);
+
+        values = Expression::AVXSrc::select (isLess, x, values);
+        registerIndices = Expression::AVXSrc::select (isLess, registerIndex, registerIndices);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (SSERegister<SrcValueType>& values, SSERegister<SrcValueType>& registerIndices, SSERegister<SrcValueType> registerIndex, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        const auto x = src.getSSE (i);
+        const auto isLess = Expression::SSESrc::lessThan (x, values);
+
+        values = Expression::SSESrc::select (isLess, x, values);
+        registerIndices = Expression::SSESrc::select (isLess, registerIndex, registerIndices);
+    }
+
+    //==============================================================================
+    VCTR_FORCEDINLINE static constexpr value_type finalizeReduction (const std::array<value_type, 1>& index)
+    {
+        return index[0];
+    }
+};
+
 } // namespace vctr::expressions
 
 namespace vctr
@@ -202,4 +290,13 @@ constexpr inline ExpressionChainBuilder<expressions::Min> min;
     @ingroup Expressions
  */
 constexpr inline ExpressionChainBuilder<expressions::MinAbs> minAbs;
+
+/** Computes the index of the first minimum value of the source values (aka argMin).
+
+    The result is unspecified if the source values contain NaN. Only sources with real floating point values are
+    reduced with SIMD registers, all other sources, including integers, are reduced element wise.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::IndexOfMin> indexOfMin;
 }
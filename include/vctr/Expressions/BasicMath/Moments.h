@@ -0,0 +1,413 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** The count, mean and the sums of the second to fourth powers of the deviations from the mean of a sequence of
+    values, as computed by the moments reduction expression.
+
+    Two instances that were computed from different blocks of values can be merged into the moments of the
+    concatenation of both blocks, e.g. to combine the results of multiple threads or to track the moments of a signal
+    across subsequent blocks.
+ */
+template <class T>
+struct CentralMoments
+{
+    T count = 0;
+    T mean = 0;
+    T m2 = 0;
+    T m3 = 0;
+    T m4 = 0;
+
+    /** Adds a single value, following the online algorithm by Welford, extended to the higher moments by Terriberry. */
+    constexpr void add (T x)
+    {
+        const auto n1 = count;
+        count += T (1);
+
+        const auto delta = x - mean;
+        const auto deltaN = delta / count;
+        const auto deltaN2 = deltaN * deltaN;
+        const auto term = delta * deltaN * n1;
+
+        mean += deltaN;
+        m4 += term * deltaN2 * (count * count - T (3) * count + T (3)) + T (6) * deltaN2 * m2 - T (4) * deltaN * m3;
+        m3 += term * deltaN * (count - T (2)) - T (3) * deltaN * m2;
+        m2 += term;
+    }
+
+    /** Merges the moments of another block of values into these, following the pairwise algorithm by Chan et al. */
+    constexpr void merge (const CentralMoments& other)
+    {
+        if (other.count == T (0))
+            return;
+
+        if (count == T (0))
+        {
+            *this = other;
+            return;
+        }
+
+        const auto nA = count;
+        const auto nB = other.count;
+        const auto n = nA + nB;
+
+        const auto delta = other.mean - mean;
+        const auto delta2 = delta * delta;
+        const auto nAnB = nA * nB;
+
+        mean += delta * nB / n;
+
+        m4 += other.m4
+            + delta2 * delta2 * nAnB * (nA * nA - nAnB + nB * nB) / (n * n * n)
+            + T (6) * delta2 * (nA * nA * other.m2 + nB * nB * m2) / (n * n)
+            + T (4) * delta * (nA * other.m3 - nB * m3) / n;
+
+        m3 += other.m3
+            + delta2 * delta * nAnB * (nA - nB) / (n * n)
+            + T (3) * delta * (nA * other.m2 - nB * m2) / n;
+
+        m2 += other.m2 + delta2 * nAnB / n;
+
+        count = n;
+    }
+
+    /** Returns the population variance. */
+    constexpr T variance() const { return m2 / count; }
+
+    /** Returns the population standard deviation. */
+    T stdDev() const { return std::sqrt (variance()); }
+
+    /** Returns the population skewness. */
+    T skewness() const { return (m3 / count) / (variance() * stdDev()); }
+
+    /** Returns the excess kurtosis, which is zero for normally distributed values. */
+    constexpr T kurtosis() const { return (count * m4) / (m2 * m2) - T (3); }
+};
+
+namespace detail
+{
+/** Selects the result of the moments expression. */
+enum class MomentsResult
+{
+    all,
+    variance,
+    stdDev,
+    skewness,
+    kurtosis
+};
+} // namespace detail
+
+} // namespace vctr
+
+namespace vctr::expressions
+{
+
+template <size_t extent, class SrcType, is::constant Result>
+requires is::realFloatNumber<ValueType<SrcType>>
+class Moments : public ExpressionTemplateBase
+{
+public:
+    using SrcValueType = ValueType<SrcType>;
+
+    /** The partial results are accumulated in double precision when reduced element wise, so that the count stays
+        exact for large float sources.
+     */
+    using PartialResultType = std::common_type_t<SrcValueType, double>;
+
+    /** The indices of the partial results. The sums of the third and fourth powers are only tracked if needed. */
+    enum PartialResult : size_t
+    {
+        count,
+        mean,
+        m2,
+        m3,
+        m4
+    };
+
+    static constexpr size_t highestOrder = Result::value == detail::MomentsResult::kurtosis || Result::value == detail::MomentsResult::all ? 4
+                                         : Result::value == detail::MomentsResult::skewness                                              ? 3
+                                                                                                                                         : 2;
+
+    static constexpr size_t numPartialResults = highestOrder + 2;
+
+    using value_type = std::array<PartialResultType, numPartialResults>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (Moments, src)
+
+    static constexpr value_type reductionResultInitValue = {};
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    {
+        auto moments = toCentralMoments (result);
+        moments.add (PartialResultType (src[i]));
+
+        result[count] = moments.count;
+        result[mean] = moments.mean;
+        result[m2] = moments.m2;
+
+        if constexpr (highestOrder >= 3)
+            result[m3] = moments.m3;
+
+        if constexpr (highestOrder >= 4)
+            result[m4] = moments.m4;
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    // Each lane runs its own Welford update. Since every accumulator set reduces every numAccumulators-th register in
+    // order, the count of all lanes is known from the index, which saves tracking it in a register. It is not
+    // representable exactly by large float values, so the coefficients derived from it are computed in double
+    // precision.
+    VCTR_FORCEDINLINE void reduceNeonRegisterWise (std::array<NeonRegister<SrcValueType>, numPartialResults>& result, size_t i) const
+    requires Config::archARM && has::getNeon<SrcType>
+    {
+        using Neon = NeonRegister<SrcValueType>;
+
+        const auto n = PartialResultType (i / Neon::numElements / ReductionExpression::numAccumulators + 1);
+        const auto x = src.getNeon (i);
+
+        const auto delta = Neon::sub (x, result[mean]);
+        const auto deltaN = Neon::mul (delta, Neon::broadcast (SrcValueType (PartialResultType (1) / n)));
+        result[mean] = Neon::add (result[mean], deltaN);
+        const auto term = Neon::mul (delta, Neon::sub (x, result[mean]));
+
+        if constexpr (highestOrder >= 4)
+        {
+            const auto deltaN2 = Neon::mul (deltaN, deltaN);
+            const auto a = Neon::mul (Neon::mul (term, deltaN2), Neon::broadcast (SrcValueType (n * n - PartialResultType (3) * n + PartialResultType (3))));
+            const auto b = Neon::mul (Neon::mul (deltaN2, result[m2]), Neon::broadcast (SrcValueType (6)));
+            const auto c = Neon::mul (Neon::mul (deltaN, result[m3]), Neon::broadcast (SrcValueType (4)));
+            result[m4] = Neon::add (result[m4], Neon::sub (Neon::add (a, b), c));
+        }
+
+        if constexpr (highestOrder >= 3)
+        {
+            const auto a = Neon::mul (Neon::mul (term, deltaN), Neon::broadcast (SrcValueType (n - PartialResultType (2))));
+            const auto b = Neon::mul (Neon::mul (deltaN, result[m2]), Neon::broadcast (SrcValueType (3)));
+            result[m3] = Neon::add (result[m3], Neon::sub (a, b));
+        }
+
+        result[m2] = Neon::add (result[m2], term);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (std::array<AVX512Register<SrcValueType>, numPartialResults>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType>
+    {
+        using AVX512 = AVX512Register<SrcValueType>;
+
+        const auto n = PartialResultType (i / AVX512::numElements / ReductionExpression::numAccumulators + 1);
+        const auto x = src.getAVX512 (i);
+
+        const auto delta = AVX512::sub (x, result[mean]);
+        const auto deltaN = AVX512::mul (delta, AVX512::broadcast (SrcValueType (PartialResultType (1) / n)));
+        result[mean] = AVX512::add (result[mean], deltaN);
+        const auto term = AVX512::mul (delta, AVX512::sub (x, result[mean]));
+
+        if constexpr (highestOrder >= 4)
+        {
+            const auto deltaN2 = AVX512::mul (deltaN, deltaN);
+            const auto a = AVX512::mul (AVX512::mul (term, deltaN2), AVX512::broadcast (SrcValueType (n * n - PartialResultType (3) * n + PartialResultType (3))));
+            const auto b = AVX512::mul (AVX512::mul (deltaN2, result[m2]), AVX512::broadcast (SrcValueType (6)));
+            const auto c = AVX512::mul (AVX512::mul (deltaN, result[m3]), AVX512::broadcast (SrcValueType (4)));
+            result[m4] = AVX512::add (result[m4], AVX512::sub (AVX512::add (a, b), c));
+        }
+
+        if constexpr (highestOrder >= 3)
+        {
+            const auto a = AVX512::mul (AVX512::mul (term, deltaN), AVX512::broadcast (SrcValueType (n - PartialResultType (2))));
+            const auto b = AVX512::mul (AVX512::mul (deltaN, result[m2]), AVX512::broadcast (SrcValueType (3)));
+            result[m3] = AVX512::add (result[m3], AVX512::sub (a, b));
+        }
+
+        result[m2] = AVX512::add (result[m2], term);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (std::array<AVXRegister<SrcValueType>, numPartialResults>& result, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcType>
+    {
+        using AVX = AVXRegister<SrcValueType>;
+
+        const auto n = PartialResultType (i / AVX::numElements / ReductionExpression::numAccumulators + 1);
+        const auto x = src.getAVX (i);
+
+        const auto delta = AVX::sub (x, result[mean]);
+        const auto deltaN = AVX::mul (delta, AVX::broadcast (SrcValueType (PartialResultType (1) / n)));
+        result[mean] = AVX::add (result[mean], deltaN);
+        const auto term = AVX::mul (delta, AVX::sub (x, result[mean]));
+
+        if constexpr (highestOrder >= 4)
+        {
+            const auto deltaN2 = AVX::mul (deltaN, deltaN);
+            const auto a = AVX::mul (AVX::mul (term, deltaN2), AVX::broadcast (SrcValueType (n * n - PartialResultType (3) * n + PartialResultType (3))));
+            const auto b = AVX::mul (AVX::mul (deltaN2, result[m2]), AVX::broadcast (SrcValueType (6)));
+            const auto c = AVX::mul (AVX::mul (deltaN, result[m3]), AVX::broadcast (SrcValueType (4)));
+            result[m4] = AVX::add (result[m4], AVX::sub (AVX::add (a, b), c));
+        }
+
+        if constexpr (highestOrder >= 3)
+        {
+            const auto a = AVX::mul (AVX::mul (term, deltaN), AVX::broadcast (SrcValueType (n - PartialResultType (2))));
+            const auto b = AVX::mul (AVX::mul (deltaN, result[m2]), AVX::broadcast (SrcValueType (3)));
+            result[m3] = AVX::add (result[m3], AVX::sub (a, b));
+        }
+
+        result[m2] = AVX::add (result[m2], term);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (std::array<SSERegister<SrcValueType>, numPartialResults>& result, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcType>
+    {
+        using SSE = SSERegister<SrcValueType>;
+
+        const auto n = PartialResultType (i / SSE::numElements / ReductionExpression::numAccumulators + 1);
+        const auto x = src.getSSE (i);
+
+        const auto delta = SSE::sub (x, result[mean]);
+        const auto deltaN = SSE::mul (delta, SSE::broadcast (SrcValueType (PartialResultType (1) / n)));
+        result[mean] = SSE::add (result[mean], deltaN);
+        const auto term = SSE::mul (delta, SSE::sub (x, result[mean]));
+
+        if constexpr (highestOrder >= 4)
+        {
+            const auto deltaN2 = SSE::mul (deltaN, deltaN);
+            const auto a = SSE::mul (SSE::mul (term, deltaN2), SSE::broadcast (SrcValueType (n * n - PartialResultType (3) * n + PartialResultType (3))));
+            const auto b = SSE::mul (SSE::mul (deltaN2, result[m2]), SSE::broadcast (SrcValueType (6)));
+            const auto c = SSE::mul (SSE::mul (deltaN, result[m3]), SSE::broadcast (SrcValueType (4)));
+            result[m4] = SSE::add (result[m4], SSE::sub (SSE::add (a, b), c));
+        }
+
+        if constexpr (highestOrder >= 3)
+        {
+            const auto a = SSE::mul (SSE::mul (term, deltaN), SSE::broadcast (SrcValueType (n - PartialResultType (2))));
+            const auto b = SSE::mul (SSE::mul (deltaN, result[m2]), SSE::broadcast (SrcValueType (3)));
+            result[m3] = SSE::add (result[m3], SSE::sub (a, b));
+        }
+
+        result[m2] = SSE::add (result[m2], term);
+    }
+
+    //==============================================================================
+    template <size_t n>
+    VCTR_FORCEDINLINE constexpr auto finalizeReduction (const std::array<value_type, n>& partialResults) const
+    {
+        if constexpr (n == 1)
+        {
+            return finalizeMoments (toCentralMoments (partialResults[0]));
+        }
+        else
+        {
+            // The partial results of the register lanes come without a count, see the register wise reductions. They
+            // are grouped by accumulator set, which reduced every numAccumulators-th of the registers. The remaining
+            // elements were reduced element wise into the last partial result.
+            constexpr auto numAccumulators = ReductionExpression::numAccumulators;
+            constexpr auto numLanesPerSet = (n - 1) / numAccumulators;
+
+            const auto& remainder = partialResults[n - 1];
+            const auto numRegisters = (src.size() - size_t (remainder[count])) / numLanesPerSet;
+
+            auto moments = toCentralMoments (remainder);
+
+            for (size_t p = 0; p < n - 1; ++p)
+            {
+                auto laneMoments = toCentralMoments (partialResults[p]);
+                laneMoments.count = PartialResultType ((numRegisters + numAccumulators - 1 - p / numLanesPerSet) / numAccumulators);
+                moments.merge (laneMoments);
+            }
+
+            return finalizeMoments (moments);
+        }
+    }
+
+private:
+    static constexpr auto finalizeMoments (const CentralMoments<PartialResultType>& moments)
+    {
+        if constexpr (Result::value == detail::MomentsResult::all)
+            return CentralMoments<SrcValueType> { SrcValueType (moments.count), SrcValueType (moments.mean), SrcValueType (moments.m2), SrcValueType (moments.m3), SrcValueType (moments.m4) };
+
+        if constexpr (Result::value == detail::MomentsResult::variance)
+            return SrcValueType (moments.variance());
+
+        if constexpr (Result::value == detail::MomentsResult::stdDev)
+            return SrcValueType (moments.stdDev());
+
+        if constexpr (Result::value == detail::MomentsResult::skewness)
+            return SrcValueType (moments.skewness());
+
+        if constexpr (Result::value == detail::MomentsResult::kurtosis)
+            return SrcValueType (moments.kurtosis());
+    }
+
+    static constexpr CentralMoments<PartialResultType> toCentralMoments (const value_type& partialResult)
+    {
+        CentralMoments<PartialResultType> moments { partialResult[count], partialResult[mean], partialResult[m2] };
+
+        if constexpr (highestOrder >= 3)
+            moments.m3 = partialResult[m3];
+
+        if constexpr (highestOrder >= 4)
+            moments.m4 = partialResult[m4];
+
+        return moments;
+    }
+};
+
+} // namespace vctr::expressions
+
+namespace vctr
+{
+
+/** Computes the count, mean and the sums of the second to fourth powers of the deviations from the mean of the source
+    values in a single, numerically stable pass and returns them as CentralMoments struct. These can be merged with
+    the moments of other blocks of values.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Moments, Constant<detail::MomentsResult::all>> moments;
+
+/** Computes the population variance of the source values in a single, numerically stable pass.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Moments, Constant<detail::MomentsResult::variance>> variance;
+
+/** Computes the population standard deviation of the source values in a single, numerically stable pass.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Moments, Constant<detail::MomentsResult::stdDev>> stdDev;
+
+/** Computes the population skewness of the source values in a single, numerically stable pass.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Moments, Constant<detail::MomentsResult::skewness>> skewness;
+
+/** Computes the excess kurtosis of the source values in a single, numerically stable pass.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Moments, Constant<detail::MomentsResult::kurtosis>> kurtosis;
+
+} // namespace vctr
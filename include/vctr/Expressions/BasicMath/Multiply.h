@@ -68,12 +68,44 @@ public:
     //==============================================================================
     VCTR_FORWARD_PREPARE_SIMD_EVALUATION_BINARY_EXPRESSION_MEMBER_FUNCTIONS (srcA, srcB)
 
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcAType> && has::getAVX512<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX512::mul (srcA.getAVX512 (i), srcB.getAVX512 (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") std::pair<AVX512Register<value_type>, AVX512Register<value_type>> getAVX512Factors (size_t i) const
+    requires (archX64 && has::getAVX512<SrcAType> && has::getAVX512<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { srcA.getAVX512 (i), srcB.getAVX512 (i) };
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
     requires (archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
     {
         return Expression::AVX::mul (srcA.getAVX (i), srcB.getAVX (i));
     }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") std::pair<AVXRegister<value_type>, AVXRegister<value_type>> getAVXFactors (size_t i) const
+    requires (archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { srcA.getAVX (i), srcB.getAVX (i) };
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcAType> && has::getSSE<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::SSE::mul (srcA.getSSE (i), srcB.getSSE (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") std::pair<SSERegister<value_type>, SSERegister<value_type>> getSSEFactors (size_t i) const
+    requires (archX64 && has::getSSE<SrcAType> && has::getSSE<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { srcA.getSSE (i), srcB.getSSE (i) };
+    }
 };
 
 //==============================================================================
@@ -118,6 +150,26 @@ public:
     }
 
     //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+        singleSIMD.avx512 = Expression::AVX512::broadcast (single);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX512::mul (singleSIMD.avx512, src.getAVX512 (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") std::pair<AVX512Register<value_type>, AVX512Register<value_type>> getAVX512Factors (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { singleSIMD.avx512, src.getAVX512 (i) };
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
     requires has::prepareAVXEvaluation<SrcType>
@@ -132,6 +184,12 @@ public:
         return Expression::AVX::mul (singleSIMD.avx, src.getAVX (i));
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") std::pair<AVXRegister<value_type>, AVXRegister<value_type>> getAVXFactors (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { singleSIMD.avx, src.getAVX (i) };
+    }
+
     // SSE Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void prepareSSEEvaluation() const
     requires has::prepareSSEEvaluation<SrcType>
@@ -145,6 +203,12 @@ public:
     {
         return Expression::SSE::mul (singleSIMD.sse, src.getSSE (i));
     }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") std::pair<SSERegister<value_type>, SSERegister<value_type>> getSSEFactors (size_t i) const
+    requires (archX64 && has::getSSE<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { singleSIMD.sse, src.getSSE (i) };
+    }
 private:
     mutable SIMDRegisterUnion<Expression> singleSIMD {};
 };
@@ -193,6 +257,26 @@ public:
     }
 
     //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+        constantSIMD.avx512 = Expression::AVX512::broadcast (constant);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX512::mul (constantSIMD.avx512, src.getAVX512 (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") std::pair<AVX512Register<value_type>, AVX512Register<value_type>> getAVX512Factors (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { constantSIMD.avx512, src.getAVX512 (i) };
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
     requires has::prepareAVXEvaluation<SrcType>
@@ -207,6 +291,12 @@ public:
         return Expression::AVX::mul (constantSIMD.avx, src.getAVX (i));
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") std::pair<AVXRegister<value_type>, AVXRegister<value_type>> getAVXFactors (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { constantSIMD.avx, src.getAVX (i) };
+    }
+
     // SSE Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void prepareSSEEvaluation() const
     requires has::prepareSSEEvaluation<SrcType>
@@ -221,6 +311,12 @@ public:
         return Expression::SSE::mul (constantSIMD.sse, src.getSSE (i));
     }
 
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") std::pair<SSERegister<value_type>, SSERegister<value_type>> getSSEFactors (size_t i) const
+    requires (archX64 && has::getSSE<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return { constantSIMD.sse, src.getSSE (i) };
+    }
+
 private:
     mutable SIMDRegisterUnion<Expression> constantSIMD {};
 };
@@ -0,0 +1,267 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::expressions
+{
+
+template <size_t extent, class SrcType>
+requires is::realOrComplexFloatNumber<ValueType<SrcType>>
+class L1Norm : public ExpressionTemplateBase
+{
+public:
+    using value_type = RealType<ValueType<SrcType>>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (L1Norm, src)
+
+    static constexpr value_type reductionResultInitValue = 0;
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    {
+        result += std::abs (src[i]);
+    }
+
+    //==============================================================================
+    VCTR_FORCEDINLINE value_type reduceVectorOp() const
+    requires is::suitableForAccelerateRealFloatVectorReductionOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> && Expression::allElementTypesSame
+    {
+        return Expression::Accelerate::l1Norm (src.data(), size());
+    };
+
+    VCTR_FORCEDINLINE value_type reduceVectorOp() const
+    requires is::suitableForIppRealFloatVectorReductionOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable> && Expression::allElementTypesSame
+    {
+        return Expression::IPP::l1Norm (src.data(), sizeToInt (size()));
+    };
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    VCTR_FORCEDINLINE void reduceNeonRegisterWise (NeonRegister<value_type>& result, size_t i) const
+    requires Config::archARM && has::getNeon<SrcType> && is::realFloatNumber<ValueType<SrcType>>
+    {
+        result = Expression::Neon::add (result, Expression::Neon::abs (src.getNeon (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<ValueType<SrcType>>
+    {
+        const auto avx512SignBit = Expression::AVX512::broadcast (value_type (-0.0));
+
+        result = Expression::AVX512::add (result, Expression::AVX512::andNot (avx512SignBit, src.getAVX512 (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<ValueType<SrcType>>
+    {
+        const auto avxSignBit = Expression::AVX::broadcast (value_type (-0.0));
+
+        result = Expression::AVX::add (result, Expression::AVX::andNot (avxSignBit, src.getAVX (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (SSERegister<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcType> && is::realFloatNumber<ValueType<SrcType>>
+    {
+        const auto sseSignBit = Expression::SSE::broadcast (value_type (-0.0));
+
+        result = Expression::SSE::add (result, Expression::SSE::andNot (sseSignBit, src.getSSE (i)));
+    }
+
+    //==============================================================================
+    template <size_t n>
+    VCTR_FORCEDINLINE static constexpr value_type finalizeReduction (const std::array<value_type, n>& sums)
+    {
+        if constexpr (n == 1)
+            return sums[0];
+
+        return std::reduce (sums.begin(), sums.end());
+    }
+};
+
+template <size_t extent, class SrcType>
+requires is::realOrComplexFloatNumber<ValueType<SrcType>>
+class L2Norm : public ExpressionTemplateBase
+{
+public:
+    using value_type = RealType<ValueType<SrcType>>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (L2Norm, src)
+
+    static constexpr value_type reductionResultInitValue = 0;
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    {
+        result += squaredMagnitude (src[i]);
+    }
+
+    //==============================================================================
+    VCTR_FORCEDINLINE value_type reduceVectorOp() const
+    requires is::suitableForIppRealFloatVectorReductionOp<SrcType, value_type> && Expression::allElementTypesSame
+    {
+        const auto norm = Expression::IPP::l2Norm (src.data(), sizeToInt (size()));
+
+        return isSafeSquaredSum (norm * norm) ? norm : scaledL2Norm();
+    };
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    VCTR_FORCEDINLINE void reduceNeonRegisterWise (NeonRegister<value_type>& result, size_t i) const
+    requires Config::archARM && has::getNeon<SrcType> && is::realFloatNumber<ValueType<SrcType>>
+    {
+        auto s = src.getNeon (i);
+        result = Expression::Neon::add (result, Expression::Neon::mul (s, s));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType> && is::realFloatNumber<ValueType<SrcType>>
+    {
+        auto s = src.getAVX512 (i);
+
+        if constexpr (Config::hasFMA)
+            result = Expression::AVX512::fma (s, s, result);
+        else
+            result = Expression::AVX512::add (result, Expression::AVX512::mul (s, s));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcType> && is::realFloatNumber<ValueType<SrcType>>
+    {
+        auto s = src.getAVX (i);
+
+        if constexpr (Config::hasFMA)
+            result = Expression::AVX::fma (s, s, result);
+        else
+            result = Expression::AVX::add (result, Expression::AVX::mul (s, s));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (SSERegister<value_type>& result, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcType> && is::realFloatNumber<ValueType<SrcType>>
+    {
+        auto s = src.getSSE (i);
+
+        if constexpr (Config::hasFMA)
+            result = Expression::SSE::fma (s, s, result);
+        else
+            result = Expression::SSE::add (result, Expression::SSE::mul (s, s));
+    }
+
+    //==============================================================================
+    template <size_t n>
+    VCTR_FORCEDINLINE constexpr value_type finalizeReduction (const std::array<value_type, n>& squaredSums) const
+    {
+        auto squaredSum = n == 1 ? squaredSums[0] : std::reduce (squaredSums.begin(), squaredSums.end());
+
+        return isSafeSquaredSum (squaredSum) ? squareRoot (squaredSum) : scaledL2Norm();
+    }
+
+private:
+    /** The squared sum of a source is only accurate if no square overflowed and the sum is large enough that squares
+        which underflowed into the denormal range or to zero don't contribute a significant error. A sum of exactly
+        zero is not considered safe, since it might be the result of squares that all underflowed.
+     */
+    static constexpr bool isSafeSquaredSum (value_type squaredSum)
+    {
+        constexpr auto lowerThreshold = std::numeric_limits<value_type>::min() / std::numeric_limits<value_type>::epsilon();
+
+        return squaredSum >= lowerThreshold && squaredSum <= std::numeric_limits<value_type>::max();
+    }
+
+    static constexpr value_type squaredMagnitude (value_type s) { return s * s; }
+
+    static constexpr value_type squaredMagnitude (const std::complex<value_type>& s) { return s.real() * s.real() + s.imag() * s.imag(); }
+
+    static constexpr value_type squareRoot (value_type x)
+    {
+    #if VCTR_USE_GCEM
+        if (std::is_constant_evaluated())
+            return gcem::sqrt (x);
+    #endif
+
+        return std::sqrt (x);
+    }
+
+    /** Computes the norm in a second, scalar pass over the source, dividing all elements by the maximum magnitude
+        before squaring them. This is only needed in the rare case that the squared sum over- or underflowed.
+     */
+    constexpr value_type scaledL2Norm() const
+    {
+        value_type scale = 0;
+
+        for (size_t i = 0; i < size(); ++i)
+        {
+            const auto a = std::abs (src[i]);
+
+            // Unlike std::max, this doesn't drop NaN values. A NaN is the result, whatever the other values are.
+            if (! (a <= scale))
+            {
+                if (a != a)
+                    return a;
+
+                scale = a;
+            }
+        }
+
+        // An all zero source, whose squared sum is zero as well
+        if (scale == value_type (0))
+            return value_type (0);
+
+        // A source containing inf
+        if (scale > std::numeric_limits<value_type>::max())
+            return scale;
+
+        value_type scaledSquaredSum = 0;
+
+        for (size_t i = 0; i < size(); ++i)
+            scaledSquaredSum += squaredMagnitude (src[i] / scale);
+
+        return scale * squareRoot (scaledSquaredSum);
+    }
+};
+
+} // namespace vctr::expressions
+
+namespace vctr
+{
+
+/** Computes the L1 norm of the source values, which is the sum of their absolute values.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::L1Norm> l1Norm;
+
+/** Computes the L2 norm of the source values, which is the square root of the sum of their squared absolute values.
+
+    If the sum of squares over- or underflows, the source is evaluated a second time with all values scaled by the
+    maximum absolute value, so that the result is accurate for values close to the limits of the floating point range.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::L2Norm> l2Norm;
+
+/** Computes the L-infinity norm of the source values, which is the maximum of their absolute values. This is the
+    same as maxAbs.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::MaxAbs> lInfNorm;
+
+} // namespace vctr
@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2023 by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+
+namespace vctr::expressions
+{
+
+template <size_t extent, class SrcType, is::constant UseFastApproximation = Constant<false>>
+requires is::realFloatNumber<ValueType<SrcType>> || is::complexFloatNumber<ValueType<SrcType>>
+class Reciprocal : ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (Reciprocal, src)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        return value_type (1) / src[i];
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires archX64 && has::getAVX512<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::AVX512::fastReciprocal (src.getAVX512 (i));
+        else
+            return Expression::AVX512::div (Expression::AVX512::broadcast (value_type (1)), src.getAVX512 (i));
+    }
+
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::AVX::fastReciprocal (src.getAVX (i));
+        else
+            return Expression::AVX::div (Expression::AVX::broadcast (value_type (1)), src.getAVX (i));
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::SSE::fastReciprocal (src.getSSE (i));
+        else
+            return Expression::SSE::div (Expression::SSE::broadcast (value_type (1)), src.getSSE (i));
+    }
+
+private:
+    // There are only estimate instructions for float, double values are always computed exactly
+    static constexpr bool useFastApproximation = UseFastApproximation::value && std::is_same_v<value_type, float>;
+};
+
+} // namespace vctr::expressions
+
+namespace vctr
+{
+
+/** Computes the reciprocal 1 / x of the source values.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Reciprocal> reciprocal;
+
+/** Computes the reciprocal of the source values like reciprocal, but faster and less accurate for float values.
+
+    The SIMD implementations refine a reciprocal estimate by one Newton-Raphson step, which gives a max. error of
+    4 ulp. Subnormal values and results are flushed to zero. Double values are computed exactly.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Reciprocal, Constant<true>> fastReciprocal;
+
+} // namespace vctr
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2023 by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+
+namespace vctr::expressions
+{
+
+template <size_t extent, class SrcType, is::constant UseFastApproximation = Constant<false>>
+requires is::realFloatNumber<ValueType<SrcType>> || is::complexFloatNumber<ValueType<SrcType>>
+class Rsqrt : ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (Rsqrt, src)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        VCTR_ASSERT (inputValueValid (src[i]));
+
+        // Matches the flush to zero of the SIMD implementations
+        if constexpr (useFastApproximation)
+        {
+            if (std::fpclassify (src[i]) == FP_SUBNORMAL)
+                return std::numeric_limits<value_type>::infinity();
+        }
+
+        return value_type (1) / std::sqrt (src[i]);
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires archX64 && has::getAVX512<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::AVX512::fastRsqrt (src.getAVX512 (i));
+        else
+            return Expression::AVX512::div (Expression::AVX512::broadcast (value_type (1)), Expression::AVX512::sqrt (src.getAVX512 (i)));
+    }
+
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::AVX::fastRsqrt (src.getAVX (i));
+        else
+            return Expression::AVX::div (Expression::AVX::broadcast (value_type (1)), Expression::AVX::sqrt (src.getAVX (i)));
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::SSE::fastRsqrt (src.getSSE (i));
+        else
+            return Expression::SSE::div (Expression::SSE::broadcast (value_type (1)), Expression::SSE::sqrt (src.getSSE (i)));
+    }
+
+private:
+    // There are only estimate instructions for float, double values are always computed exactly
+    static constexpr bool useFastApproximation = UseFastApproximation::value && std::is_same_v<value_type, float>;
+
+    /** If the value type is real, this checks if the value is greater or equal zero */
+    static constexpr bool inputValueValid (value_type in)
+    {
+        if constexpr (is::realNumber<value_type>)
+            return in >= value_type (0);
+
+        return true;
+    }
+};
+
+} // namespace vctr::expressions
+
+namespace vctr
+{
+
+/** Computes the reciprocal square root 1 / sqrt (x) of the source values.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Rsqrt> rsqrt;
+
+/** Computes the reciprocal square root of the source values like rsqrt, but faster and less accurate for float values.
+
+    The SIMD implementations refine a reciprocal square root estimate by one Newton-Raphson step, which gives a max.
+    error of 5 ulp. Subnormal float inputs are flushed to zero and return +inf. Double values are computed exactly.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Rsqrt, Constant<true>> fastRsqrt;
+
+} // namespace vctr
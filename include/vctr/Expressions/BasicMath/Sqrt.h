@@ -23,7 +23,7 @@
 namespace vctr::expressions
 {
 
-template <size_t extent, class SrcType>
+template <size_t extent, class SrcType, is::constant UseFastApproximation = Constant<false>>
 requires is::realFloatNumber<ValueType<SrcType>> || is::complexFloatNumber<ValueType<SrcType>>
 class Sqrt : ExpressionTemplateBase
 {
@@ -60,7 +60,43 @@ public:
         return dst;
     }
 
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires archX64 && has::getAVX512<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::AVX512::fastSqrt (src.getAVX512 (i));
+        else
+            return Expression::AVX512::sqrt (src.getAVX512 (i));
+    }
+
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::AVX::fastSqrt (src.getAVX (i));
+        else
+            return Expression::AVX::sqrt (src.getAVX (i));
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        if constexpr (useFastApproximation)
+            return Expression::SSE::fastSqrt (src.getSSE (i));
+        else
+            return Expression::SSE::sqrt (src.getSSE (i));
+    }
+
 private:
+    // There are only estimate instructions for float, double values are always computed exactly
+    static constexpr bool useFastApproximation = UseFastApproximation::value && std::is_same_v<value_type, float>;
+
     /** If the value type is real, this checks if the value is greater or equal zero */
     static constexpr bool inputValueValid (value_type in)
     {
@@ -82,4 +118,13 @@ namespace vctr
  */
 constexpr inline ExpressionChainBuilder<expressions::Sqrt> sqrt;
 
+/** Computes the square root of the source values like sqrt, but faster and less accurate for float values.
+
+    The SIMD implementations refine a reciprocal square root estimate by one Newton-Raphson step, which gives a max.
+    error of 5 ulp. Subnormal values are flushed to zero. Double values are computed exactly.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Sqrt, Constant<true>> fastSqrt;
+
 } // namespace vctr
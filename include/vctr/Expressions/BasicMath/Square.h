@@ -65,6 +65,14 @@ public:
     //==============================================================================
     VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
 
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires archX64 && has::getAVX512<SrcType> && Expression::CommonElement::isRealFloat
+    {
+        auto x = src.getAVX512 (i);
+        return Expression::AVX512::mul (x, x);
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
     requires archX64 && has::getAVX<SrcType> && Expression::CommonElement::isRealFloat
@@ -0,0 +1,190 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2023 by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** The result of the stats reduction expression. */
+template <class T>
+struct Statistics
+{
+    T min;
+    T max;
+    T minAbs;
+    T maxAbs;
+    T mean;
+    T meanSquare;
+    T rms;
+};
+
+} // namespace vctr
+
+namespace vctr::expressions
+{
+
+template <size_t extent, class SrcType>
+requires is::realFloatNumber<ValueType<SrcType>>
+class Stats : public ExpressionTemplateBase
+{
+public:
+    using SrcValueType = ValueType<SrcType>;
+
+    /** The indices of the partial results that are reduced in a single pass. The max abs value is not tracked, since
+        it is the larger one of the negated min and the max value.
+     */
+    enum PartialResult : size_t
+    {
+        minValue,
+        maxValue,
+        minAbsValue,
+        sum,
+        sumOfSquares,
+        numPartialResults
+    };
+
+    using value_type = std::array<SrcValueType, numPartialResults>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (Stats, src)
+
+    static constexpr value_type reductionResultInitValue = { std::numeric_limits<SrcValueType>::max(),
+                                                             std::numeric_limits<SrcValueType>::lowest(),
+                                                             std::numeric_limits<SrcValueType>::max(),
+                                                             SrcValueType (0),
+                                                             SrcValueType (0) };
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    {
+        const auto x = src[i];
+
+        result[minValue] = std::min (result[minValue], x);
+        result[maxValue] = std::max (result[maxValue], x);
+        result[minAbsValue] = std::min (result[minAbsValue], std::abs (x));
+        result[sum] += x;
+        result[sumOfSquares] += x * x;
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    VCTR_FORCEDINLINE void reduceNeonRegisterWise (std::array<NeonRegister<SrcValueType>, numPartialResults>& result, size_t i) const
+    requires Config::archARM && has::getNeon<SrcType>
+    {
+        using Neon = NeonRegister<SrcValueType>;
+
+        const auto x = src.getNeon (i);
+
+        result[minValue] = Neon::min (result[minValue], x);
+        result[maxValue] = Neon::max (result[maxValue], x);
+        result[minAbsValue] = Neon::min (result[minAbsValue], Neon::abs (x));
+        result[sum] = Neon::add (result[sum], x);
+        result[sumOfSquares] = Neon::add (result[sumOfSquares], Neon::mul (x, x));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (std::array<AVX512Register<SrcValueType>, numPartialResults>& result, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType>
+    {
+        using AVX512 = AVX512Register<SrcValueType>;
+
+        // Unlike in Abs, the sign bit register is no static, since its guard would force the accumulators to memory
+        const auto avx512SignBit = AVX512::broadcast (SrcValueType (-0.0));
+
+        const auto x = src.getAVX512 (i);
+
+        result[minValue] = AVX512::min (result[minValue], x);
+        result[maxValue] = AVX512::max (result[maxValue], x);
+        result[minAbsValue] = AVX512::min (result[minAbsValue], AVX512::andNot (avx512SignBit, x));
+        result[sum] = AVX512::add (result[sum], x);
+        result[sumOfSquares] = AVX512::add (result[sumOfSquares], AVX512::mul (x, x));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (std::array<AVXRegister<SrcValueType>, numPartialResults>& result, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcType>
+    {
+        using AVX = AVXRegister<SrcValueType>;
+
+        const auto avxSignBit = AVX::broadcast (SrcValueType (-0.0));
+
+        const auto x = src.getAVX (i);
+
+        result[minValue] = AVX::min (result[minValue], x);
+        result[maxValue] = AVX::max (result[maxValue], x);
+        result[minAbsValue] = AVX::min (result[minAbsValue], AVX::andNot (avxSignBit, x));
+        result[sum] = AVX::add (result[sum], x);
+        result[sumOfSquares] = AVX::add (result[sumOfSquares], AVX::mul (x, x));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (std::array<SSERegister<SrcValueType>, numPartialResults>& result, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcType>
+    {
+        using SSE = SSERegister<SrcValueType>;
+
+        const auto sseSignBit = SSE::broadcast (SrcValueType (-0.0));
+
+        const auto x = src.getSSE (i);
+
+        result[minValue] = SSE::min (result[minValue], x);
+        result[maxValue] = SSE::max (result[maxValue], x);
+        result[minAbsValue] = SSE::min (result[minAbsValue], SSE::andNot (sseSignBit, x));
+        result[sum] = SSE::add (result[sum], x);
+        result[sumOfSquares] = SSE::add (result[sumOfSquares], SSE::mul (x, x));
+    }
+
+    //==============================================================================
+    template <size_t n>
+    VCTR_FORCEDINLINE constexpr Statistics<SrcValueType> finalizeReduction (const std::array<value_type, n>& partialResults) const
+    {
+        auto combined = partialResults[0];
+
+        for (size_t p = 1; p < n; ++p)
+        {
+            combined[minValue] = std::min (combined[minValue], partialResults[p][minValue]);
+            combined[maxValue] = std::max (combined[maxValue], partialResults[p][maxValue]);
+            combined[minAbsValue] = std::min (combined[minAbsValue], partialResults[p][minAbsValue]);
+            combined[sum] += partialResults[p][sum];
+            combined[sumOfSquares] += partialResults[p][sumOfSquares];
+        }
+
+        const auto meanSquare = combined[sumOfSquares] / SrcValueType (size());
+
+        return { combined[minValue],
+                 combined[maxValue],
+                 combined[minAbsValue],
+                 std::max (-combined[minValue], combined[maxValue]),
+                 combined[sum] / SrcValueType (size()),
+                 meanSquare,
+                 std::sqrt (meanSquare) };
+    }
+};
+
+} // namespace vctr::expressions
+
+namespace vctr
+{
+
+/** Computes the min, max, minAbs, maxAbs, mean, meanSquare and rms value of the source values in a single pass and
+    returns them as Statistics struct.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::Stats> stats;
+
+} // namespace vctr
@@ -55,11 +55,44 @@ public:
     //==============================================================================
     VCTR_FORWARD_PREPARE_SIMD_EVALUATION_BINARY_EXPRESSION_MEMBER_FUNCTIONS (srcA, srcB)
 
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcAType> && has::getAVX512<SrcBType> && (Expression::CommonElement::isRealFloat || Expression::CommonElement::isInt))
+    {
+        if constexpr (Config::hasFMA && has::getAVX512Factors<SrcAType>)
+        {
+            const auto [a, b] = srcA.getAVX512Factors (i);
+            return Expression::AVX512::fms (a, b, srcB.getAVX512 (i));
+        }
+        else if constexpr (Config::hasFMA && has::getAVX512Factors<SrcBType>)
+        {
+            const auto [a, b] = srcB.getAVX512Factors (i);
+            return Expression::AVX512::fnma (a, b, srcA.getAVX512 (i));
+        }
+        else
+        {
+            return Expression::AVX512::sub (srcA.getAVX512 (i), srcB.getAVX512 (i));
+        }
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
     requires (archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::CommonElement::isRealFloat)
     {
-        return Expression::AVX::sub (srcA.getAVX (i), srcB.getAVX (i));
+        if constexpr (Config::hasFMA && has::getAVXFactors<SrcAType>)
+        {
+            const auto [a, b] = srcA.getAVXFactors (i);
+            return Expression::AVX::fms (a, b, srcB.getAVX (i));
+        }
+        else if constexpr (Config::hasFMA && has::getAVXFactors<SrcBType>)
+        {
+            const auto [a, b] = srcB.getAVXFactors (i);
+            return Expression::AVX::fnma (a, b, srcA.getAVX (i));
+        }
+        else
+        {
+            return Expression::AVX::sub (srcA.getAVX (i), srcB.getAVX (i));
+        }
     }
 
     VCTR_FORCEDINLINE VCTR_TARGET ("avx2") AVXRegister<value_type> getAVX (size_t i) const
@@ -72,7 +105,20 @@ public:
     VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
     requires (archX64 && has::getSSE<SrcAType> && has::getSSE<SrcBType>)
     {
-        return Expression::SSE::sub (srcA.getSSE (i), srcB.getSSE (i));
+        if constexpr (Config::hasFMA && has::getSSEFactors<SrcAType>)
+        {
+            const auto [a, b] = srcA.getSSEFactors (i);
+            return Expression::SSE::fms (a, b, srcB.getSSE (i));
+        }
+        else if constexpr (Config::hasFMA && has::getSSEFactors<SrcBType>)
+        {
+            const auto [a, b] = srcB.getSSEFactors (i);
+            return Expression::SSE::fnma (a, b, srcA.getSSE (i));
+        }
+        else
+        {
+            return Expression::SSE::sub (srcA.getSSE (i), srcB.getSSE (i));
+        }
     }
 
     // Neon Implementation
@@ -114,6 +160,20 @@ public:
     }
 
     //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+        singleSIMD.avx512 = Expression::AVX512::broadcast (single);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && (Expression::CommonElement::isRealFloat || Expression::CommonElement::isInt))
+    {
+        return Expression::AVX512::sub (singleSIMD.avx512, src.getAVX512 (i));
+    }
+
     // AVX Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
     requires has::prepareAVXEvaluation<SrcType>
@@ -196,6 +256,20 @@ public:
     }
 
     //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+        singleSIMD.avx512 = Expression::AVX512::broadcast (single);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && (Expression::CommonElement::isRealFloat || Expression::CommonElement::isInt))
+    {
+        return Expression::AVX512::sub (src.getAVX512 (i), singleSIMD.avx512);
+    }
+
     VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
     requires has::prepareAVXEvaluation<SrcType>
     {
@@ -0,0 +1,247 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::detail
+{
+
+/** Adds x to sum and accumulates the rounding error of that addition in compensation, so that sum + compensation is
+    a closer approximation of the exact sum than sum alone. The rounding error is computed with the branch free TwoSum
+    algorithm, which, unlike the Kahan summation step, is also exact if x is larger in magnitude than sum.
+ */
+template <is::realFloatNumber T>
+VCTR_FORCEDINLINE constexpr void compensatedAdd (T& sum, T& compensation, T x)
+{
+    const auto t = sum + x;
+    const auto z = t - sum;
+    compensation += (sum - (t - z)) + (x - z);
+    sum = t;
+}
+
+template <class T>
+VCTR_FORCEDINLINE void compensatedAdd (NeonRegister<T>& sum, NeonRegister<T>& compensation, NeonRegister<T> x)
+{
+    const auto s = sum;
+    sum = NeonRegister<T>::add (s, x);
+
+    const auto z = NeonRegister<T>::sub (sum, s);
+    const auto error = NeonRegister<T>::add (NeonRegister<T>::sub (s, NeonRegister<T>::sub (sum, z)), NeonRegister<T>::sub (x, z));
+    compensation = NeonRegister<T>::add (compensation, error);
+}
+
+template <class T>
+VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void compensatedAdd (AVX512Register<T>& sum, AVX512Register<T>& compensation, AVX512Register<T> x)
+{
+    const auto s = sum;
+    sum = AVX512Register<T>::add (s, x);
+
+    const auto z = AVX512Register<T>::sub (sum, s);
+    const auto error = AVX512Register<T>::add (AVX512Register<T>::sub (s, AVX512Register<T>::sub (sum, z)), AVX512Register<T>::sub (x, z));
+    compensation = AVX512Register<T>::add (compensation, error);
+}
+
+template <class T>
+VCTR_FORCEDINLINE VCTR_TARGET ("avx") void compensatedAdd (AVXRegister<T>& sum, AVXRegister<T>& compensation, AVXRegister<T> x)
+{
+    const auto s = sum;
+    sum = AVXRegister<T>::add (s, x);
+
+    const auto z = AVXRegister<T>::sub (sum, s);
+    const auto error = AVXRegister<T>::add (AVXRegister<T>::sub (s, AVXRegister<T>::sub (sum, z)), AVXRegister<T>::sub (x, z));
+    compensation = AVXRegister<T>::add (compensation, error);
+}
+
+template <class T>
+VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void compensatedAdd (SSERegister<T>& sum, SSERegister<T>& compensation, SSERegister<T> x)
+{
+    const auto s = sum;
+    sum = SSERegister<T>::add (s, x);
+
+    const auto z = SSERegister<T>::sub (sum, s);
+    const auto error = SSERegister<T>::add (SSERegister<T>::sub (s, SSERegister<T>::sub (sum, z)), SSERegister<T>::sub (x, z));
+    compensation = SSERegister<T>::add (compensation, error);
+}
+
+/** Sums up the values using the Kahan-Neumaier algorithm. Used to combine the partial sums and compensations of all
+    accumulator lanes in the finalizeReduction step of compensated reductions.
+ */
+template <class T, size_t n>
+constexpr T neumaierSum (const std::array<T, n>& values)
+{
+    T sum = 0;
+    T compensation = 0;
+
+    for (auto x : values)
+    {
+        const auto t = sum + x;
+        const auto absSum = sum < T (0) ? -sum : sum;
+        const auto absX = x < T (0) ? -x : x;
+
+        compensation += absSum >= absX ? (sum - t) + x : (x - t) + sum;
+        sum = t;
+    }
+
+    return sum + compensation;
+}
+
+} // namespace vctr::detail
+
+namespace vctr::expressions
+{
+
+/** Sums up the source values or their squares using compensated summation and optionally divides the result by the
+    number of source values. Used to implement SumCompensated, MeanCompensated and MeanSquareCompensated.
+ */
+template <size_t extent, class SrcType, is::constantWithType<bool> SquareValues, is::constantWithType<bool> DivideBySize>
+requires is::realFloatNumber<ValueType<SrcType>>
+class CompensatedSum : public ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (CompensatedSum, src)
+
+    static constexpr bool squareValues = SquareValues::value;
+    static constexpr bool divideBySize = DivideBySize::value;
+
+    static constexpr value_type reductionResultInitValue = 0;
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, size_t i) const
+    {
+        result += summand (src[i]);
+    }
+
+    VCTR_FORCEDINLINE constexpr void reduceElementWise (value_type& result, value_type& compensation, size_t i) const
+    {
+        detail::compensatedAdd (result, compensation, summand (src[i]));
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    VCTR_FORCEDINLINE void reduceNeonRegisterWise (NeonRegister<value_type>& result, NeonRegister<value_type>& compensation, size_t i) const
+    requires Config::archARM && has::getNeon<SrcType>
+    {
+        auto s = src.getNeon (i);
+
+        if constexpr (squareValues)
+            s = Expression::Neon::mul (s, s);
+
+        detail::compensatedAdd (result, compensation, s);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void reduceAVX512RegisterWise (AVX512Register<value_type>& result, AVX512Register<value_type>& compensation, size_t i) const
+    requires Config::archX64 && has::getAVX512<SrcType>
+    {
+        auto s = src.getAVX512 (i);
+
+        if constexpr (squareValues)
+            s = Expression::AVX512::mul (s, s);
+
+        detail::compensatedAdd (result, compensation, s);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void reduceAVXRegisterWise (AVXRegister<value_type>& result, AVXRegister<value_type>& compensation, size_t i) const
+    requires Config::archX64 && has::getAVX<SrcType>
+    {
+        auto s = src.getAVX (i);
+
+        if constexpr (squareValues)
+            s = Expression::AVX::mul (s, s);
+
+        detail::compensatedAdd (result, compensation, s);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void reduceSSERegisterWise (SSERegister<value_type>& result, SSERegister<value_type>& compensation, size_t i) const
+    requires Config::archX64 && has::getSSE<SrcType>
+    {
+        auto s = src.getSSE (i);
+
+        if constexpr (squareValues)
+            s = Expression::SSE::mul (s, s);
+
+        detail::compensatedAdd (result, compensation, s);
+    }
+
+    //==============================================================================
+    template <size_t n>
+    VCTR_FORCEDINLINE constexpr value_type finalizeReduction (const std::array<value_type, n>& sumsAndCompensations) const
+    {
+        const auto sum = detail::neumaierSum (sumsAndCompensations);
+
+        if constexpr (divideBySize)
+            return sum / value_type (src.size());
+        else
+            return sum;
+    }
+
+private:
+    VCTR_FORCEDINLINE static constexpr value_type summand (value_type x)
+    {
+        if constexpr (squareValues)
+            return x * x;
+        else
+            return x;
+    }
+};
+
+template <size_t extent, class SrcType>
+using SumCompensated = CompensatedSum<extent, SrcType, std::false_type, std::false_type>;
+
+template <size_t extent, class SrcType>
+using MeanCompensated = CompensatedSum<extent, SrcType, std::false_type, std::true_type>;
+
+template <size_t extent, class SrcType>
+using MeanSquareCompensated = CompensatedSum<extent, SrcType, std::true_type, std::true_type>;
+
+} // namespace vctr::expressions
+
+namespace vctr
+{
+
+/** Computes the sum of the source values using compensated summation.
+
+    The rounding error of each addition is tracked in a compensation value, which makes the result nearly independent
+    of the number of summed values. This is slower than sum, but considerably faster than summing float values in
+    double precision. Compensated summation relies on strict floating point semantics, so it must not be compiled with
+    fast math options that allow reassociation.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::SumCompensated> sumCompensated;
+
+/** Computes the mean value of the source values using compensated summation.
+
+    @see sumCompensated
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::MeanCompensated> meanCompensated;
+
+/** Computes the mean value of the squared source values using compensated summation.
+
+    @see sumCompensated
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::MeanSquareCompensated> meanSquareCompensated;
+
+} // namespace vctr
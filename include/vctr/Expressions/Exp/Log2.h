@@ -77,6 +77,23 @@ public:
 
         return dst;
     }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        return Expression::AVX::log2 (src.getAVX (i));
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && is::realFloatNumber<SrcValueType>
+    {
+        return Expression::SSE::log2 (src.getSSE (i));
+    }
 };
 
 } // namespace vctr::expressions
@@ -62,6 +62,20 @@ public:
     //==============================================================================
     VCTR_FORWARD_PREPARE_SIMD_EVALUATION_BINARY_EXPRESSION_MEMBER_FUNCTIONS (srcBase, srcExp)
 
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat
+    {
+        return Expression::AVX::pow (srcBase.getAVX (i), srcExp.getAVX (i));
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcAType> && has::getSSE<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat && (! is::suitableForAccelerateSSEOp<value_type, SrcAType, SrcBType>)
+    {
+        return Expression::SSE::pow (srcBase.getSSE (i), srcExp.getSSE (i));
+    }
+
     // Apple specific SIMD Implementation
     VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
     requires is::suitableForAccelerateSSEOp<value_type, SrcAType, SrcBType>
@@ -103,6 +117,38 @@ public:
         Expression::IPP::pow (base.evalNextVectorOpInExpressionChain (dst), exp, dst, sizeToInt (size()));
         return dst;
     }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
+    requires has::prepareAVXEvaluation<SrcType>
+    {
+        base.prepareAVXEvaluation();
+        expSIMD.avx = Expression::AVX::broadcast (exp);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX::pow (base.getAVX (i), expSIMD.avx);
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void prepareSSEEvaluation() const
+    requires has::prepareSSEEvaluation<SrcType>
+    {
+        base.prepareSSEEvaluation();
+        expSIMD.sse = Expression::SSE::broadcast (exp);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::SSE::pow (base.getSSE (i), expSIMD.sse);
+    }
+
+private:
+    mutable SIMDRegisterUnion<Expression> expSIMD {};
 };
 
 template <size_t extent, class SrcType>
@@ -125,6 +171,38 @@ public:
 
         return value_type (std::pow (base, exp[i]));
     }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
+    requires has::prepareAVXEvaluation<SrcType>
+    {
+        exp.prepareAVXEvaluation();
+        baseSIMD.avx = Expression::AVX::broadcast (base);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX::pow (baseSIMD.avx, exp.getAVX (i));
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void prepareSSEEvaluation() const
+    requires has::prepareSSEEvaluation<SrcType>
+    {
+        exp.prepareSSEEvaluation();
+        baseSIMD.sse = Expression::SSE::broadcast (base);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::SSE::pow (baseSIMD.sse, exp.getSSE (i));
+    }
+
+private:
+    mutable SIMDRegisterUnion<Expression> baseSIMD {};
 };
 
 template <size_t extent, class SrcType, is::constant ConstantType>
@@ -135,27 +213,141 @@ public:
 
     static constexpr value_type exp = ConstantType::value;
 
+    // Integer exponents with a magnitude up to 16 are computed by a chain of multiplications instead of pow. Starting with
+    // x, the bits of |exponent| below the most significant one are processed by squaring and multiplying by x if set.
+    static constexpr bool useMultiplicationChain = []
+    {
+        if constexpr (std::integral<std::remove_cvref_t<decltype (ConstantType::value)>>)
+            return std::cmp_greater_equal (ConstantType::value, -16) && std::cmp_less_equal (ConstantType::value, 16);
+        else
+            return false;
+    }();
+
+    static constexpr uint64_t chainExponent = useMultiplicationChain ? uint64_t (ConstantType::value < 0 ? -int64_t (ConstantType::value) : int64_t (ConstantType::value)) : 0;
+
+    static constexpr int chainStartBit = int (std::bit_width (chainExponent)) - 2;
+
     VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (PowConstantExponent, src)
 
     VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
     {
-#if VCTR_USE_GCEM
-        if constexpr (! is::complexFloatNumber<value_type>)
+        if constexpr (useMultiplicationChain)
         {
-            if (std::is_constant_evaluated())
-                return value_type (gcem::pow (src[i], exp));
+            return multiplicationChain<ScalarOps> (value_type (src[i]));
         }
+        else
+        {
+#if VCTR_USE_GCEM
+            if constexpr (! is::complexFloatNumber<value_type>)
+            {
+                if (std::is_constant_evaluated())
+                    return value_type (gcem::pow (src[i], exp));
+            }
 #endif
 
-        return value_type (std::pow (src[i], exp));
+            return value_type (std::pow (src[i], exp));
+        }
     }
     
     VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
-    requires is::suitableForIppRealOrComplexFloatVectorOp<SrcType, ValueType<SrcType>>
+    requires (! useMultiplicationChain) && is::suitableForIppRealOrComplexFloatVectorOp<SrcType, ValueType<SrcType>>
     {
         Expression::IPP::pow (src.evalNextVectorOpInExpressionChain (dst), exp, dst, sizeToInt (size()));
         return dst;
     }
+
+    //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const
+    requires useMultiplicationChain && has::prepareAVX512Evaluation<SrcType>
+    {
+        src.prepareAVX512Evaluation();
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires useMultiplicationChain && archX64 && has::getAVX512<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat
+    {
+        using Reg = Expression::AVX512;
+
+        return multiplicationChain<Reg> (src.getAVX512 (i));
+    }
+
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
+    requires has::prepareAVXEvaluation<SrcType>
+    {
+        src.prepareAVXEvaluation();
+
+        if constexpr (! useMultiplicationChain)
+            expSIMD.avx = Expression::AVX::broadcast (exp);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat
+    {
+        using Reg = Expression::AVX;
+
+        if constexpr (! useMultiplicationChain)
+            return Reg::pow (src.getAVX (i), expSIMD.avx);
+
+        return multiplicationChain<Reg> (src.getAVX (i));
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void prepareSSEEvaluation() const
+    requires has::prepareSSEEvaluation<SrcType>
+    {
+        src.prepareSSEEvaluation();
+
+        if constexpr (! useMultiplicationChain)
+            expSIMD.sse = Expression::SSE::broadcast (exp);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat
+    {
+        using Reg = Expression::SSE;
+
+        if constexpr (! useMultiplicationChain)
+            return Reg::pow (src.getSSE (i), expSIMD.sse);
+
+        return multiplicationChain<Reg> (src.getSSE (i));
+    }
+
+private:
+    mutable SIMDRegisterUnion<Expression> expSIMD {};
+
+    struct ScalarOps
+    {
+        static constexpr value_type broadcast (value_type x) { return x; }
+        static constexpr value_type mul (value_type a, value_type b) { return a * b; }
+        static constexpr value_type div (value_type a, value_type b) { return a / b; }
+    };
+
+    /** Computes x^exp through the multiplication chain, using the broadcast, mul and div functions of Ops, which is
+        either one of the SIMD register types or ScalarOps.
+     */
+    template <class Ops, class T>
+    VCTR_ALWAYSINLINE static constexpr T multiplicationChain (T x)
+    {
+        if constexpr (chainExponent == 0)
+            return Ops::broadcast (value_type (1));
+
+        auto y = x;
+
+        for (auto bit = chainStartBit; bit >= 0; --bit)
+        {
+            y = Ops::mul (y, y);
+
+            if ((chainExponent >> bit) & 1)
+                y = Ops::mul (y, x);
+        }
+
+        if constexpr (ConstantType::value < 0)
+            return Ops::div (Ops::broadcast (value_type (1)), y);
+        else
+            return y;
+    }
 };
 
 template <size_t extent, class SrcType, is::constant ConstantType>
@@ -198,6 +390,38 @@ public:
 
         return dst;
     }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") void prepareAVXEvaluation() const
+    requires has::prepareAVXEvaluation<SrcType>
+    {
+        src.prepareAVXEvaluation();
+        baseSIMD.avx = Expression::AVX::broadcast (base);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::AVX::pow (baseSIMD.avx, src.getAVX (i));
+    }
+
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") void prepareSSEEvaluation() const
+    requires has::prepareSSEEvaluation<SrcType>
+    {
+        src.prepareSSEEvaluation();
+        baseSIMD.sse = Expression::SSE::broadcast (base);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isRealFloat)
+    {
+        return Expression::SSE::pow (baseSIMD.sse, src.getSSE (i));
+    }
+
+private:
+    mutable SIMDRegisterUnion<Expression> baseSIMD {};
 };
 
 } // namespace vctr::expressions
@@ -207,6 +431,9 @@ namespace vctr
 
 /** Returns an expression that raises the elements in bases element-wise to the power of the elements in exponents.
 
+    Real floating point values are evaluated by SIMD kernels, which deviate from std::pow by up to 1 ulp for float. For
+    double, the max. error is 4 ulp for results in [1e-43, 1e43] and grows up to 20 ulp towards the limits of the range.
+
     @ingroup Expressions
  */
     template <is::anyVctrOrExpression SrcBaseType, is::anyVctrOrExpression SrcExpType>
@@ -220,6 +447,8 @@ namespace vctr
 
 /** Returns an expression that raises the base value base to the power of the elements in exponents.
 
+    See pow (bases, exponents) for the accuracy of real floating point values.
+
     @ingroup Expressions
  */
 template <is::anyVctrOrExpression Src>
@@ -231,7 +460,7 @@ constexpr auto pow (typename std::remove_cvref_t<Src>::value_type base, Src&& ex
 /** Returns an expression that raises the elements in bases to the power of the exponent value.
 
     In case you want to raise the elements to the power of 2 or 3, better use the square or cube
-    expression.
+    expression. See pow (bases, exponents) for the accuracy of real floating point values.
 
     @ingroup Expressions
 
@@ -246,6 +475,8 @@ constexpr auto pow (Src&& bases, typename std::remove_cvref_t<Src>::value_type e
 
 /** Evaluates base raised to the power of the source elements.
 
+    See pow (bases, exponents) for the accuracy of real floating point values.
+
     @ingroup Expressions
  */
 template <auto base>
@@ -253,6 +484,11 @@ constexpr inline ExpressionChainBuilder<expressions::PowConstantBase, Constant<b
 
 /** Evaluates the source elements raised to the power of exponent.
 
+    Integral exponents in [-16, 16] are computed by a chain of multiplications instead of std::pow. This is a lot faster,
+    but the rounding errors of the multiplications add up, so for real floating point values the error grows with the
+    exponent up to about |exponent| ulp. Results that are exactly representable, like powers of small integral values,
+    are still computed exactly. If you need the accuracy of pow, pass a floating point exponent like 5.0 instead.
+
     @ingroup Expressions
  */
 template <auto exponent>
@@ -213,6 +213,34 @@ struct ExpressionChainBuilderWithRuntimeArgs
         }
     }
 
+    /** Reduces the Vector passed in on the threads of pool, in case this builder terminates in a reduction expression.
+
+        @see ReductionExpression::reduceParallel
+     */
+    template <is::anyVctr Src>
+    requires is::reductionExpression<Expression<extentOf<Src>, const Src&>>
+    auto reduceParallel (const Src& src, ThreadPool& pool) const
+    {
+        auto expression = Expression<extentOf<Src>, const Src&> { src };
+        expression.template iterateOverRuntimeArgChain<0> (runtimeArgs);
+
+        return ReductionExpression::reduceParallel (expression, pool);
+    }
+
+    /** Reduces the Expression passed in on the threads of pool, in case this builder terminates in a reduction expression.
+
+        @see ReductionExpression::reduceParallel
+     */
+    template <is::expression SrcExpression>
+    requires is::reductionExpression<Expression<extentOf<SrcExpression>, SrcExpression>>
+    auto reduceParallel (SrcExpression&& e, ThreadPool& pool) const
+    {
+        auto expression = Expression<extentOf<SrcExpression>, SrcExpression> (std::forward<SrcExpression> (e));
+        expression.template iterateOverRuntimeArgChain<0> (runtimeArgs);
+
+        return ReductionExpression::reduceParallel (expression, pool);
+    }
+
     /** Returns an ExpressionChainBuilder instance which is the combination of the builder instance passed in,
         prepended by the expression represented by this builder.
      */
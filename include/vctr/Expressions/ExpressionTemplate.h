@@ -35,10 +35,28 @@ namespace vctr
  */
 struct ExpressionTemplateBase : Config
 {
+    /** Maps the value_type of an expression to its element type. Expressions that reduce into multiple values have a
+        std::array of partial results as value_type, for them this is the element type of that array.
+     */
+    template <class T>
+    struct ReturnElement
+    {
+        using Type = T;
+    };
+
+    template <class T, size_t n>
+    struct ReturnElement<std::array<T, n>>
+    {
+        using Type = T;
+    };
+
     /** Supplies some handy typedefs and traits needed when implementing expression templates. */
-    template <class ReturnElementType, class... SrcTypes>
+    template <class ReturnType, class... SrcTypes>
     struct ExpressionTypes
     {
+        /** The element type returned by the expression */
+        using ReturnElementType = typename ReturnElement<ReturnType>::Type;
+
         /** Some common traits you want to check when constraining expression template functions */
         template <class T>
         struct ElementTraits
@@ -89,6 +107,16 @@ struct ExpressionTemplateBase : Config
         /** The NeonRegister type for the common return element type */
         using NeonRet = NeonRegister<ReturnElementType>;
 
+        //==============================================================================
+        /** The AVX512Register type for the common element type */
+        using AVX512 = AVX512Register<typename CommonElement::Type>;
+
+        /** The AVX512Register type for the common source element type */
+        using AVX512Src = AVX512Register<typename CommonSrcElement::Type>;
+
+        /** The AVX512Register type for the common return element type */
+        using AVX512Ret = AVX512Register<ReturnElementType>;
+
         //==============================================================================
         /** The AVXRegister type for the common element type */
         using AVX = AVXRegister<typename CommonElement::Type>;
@@ -124,6 +152,7 @@ struct ExpressionTemplateBase : Config
         typename ExpressionTypes::NeonSrc neon;
         typename ExpressionTypes::SSESrc sse;
         typename ExpressionTypes::AVXSrc avx;
+        typename ExpressionTypes::AVX512Src avx512;
     };
 };
 
@@ -282,7 +311,7 @@ public:
     constexpr size_t size() const { return srcVecName.size(); }                                       \
     constexpr bool isNotAliased (const void* other) const { return srcVecName.isNotAliased (other); }
 
-/** Forwards prepareNeonEvaluation(), prepareAVXEvaluation() and prepareSSEEvaluation() if the SrcType supplies them. */
+/** Forwards prepareNeonEvaluation(), prepareAVX512Evaluation(), prepareAVXEvaluation() and prepareSSEEvaluation() if the SrcType supplies them. */
 #define VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS            \
     void prepareNeonEvaluation() const                                                    \
     requires has::prepareNeonEvaluation<SrcType>                                          \
@@ -290,6 +319,12 @@ public:
         src.prepareNeonEvaluation();                                                      \
     }                                                                                     \
                                                                                           \
+    VCTR_FORCEDINLINE  VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const       \
+    requires has::prepareAVX512Evaluation<SrcType>                                        \
+    {                                                                                     \
+        src.prepareAVX512Evaluation();                                                    \
+    }                                                                                     \
+                                                                                          \
     VCTR_FORCEDINLINE  VCTR_TARGET ("avx") void prepareAVXEvaluation() const              \
     requires has::prepareAVXEvaluation<SrcType> && Expression::CommonElement::isRealFloat \
     {                                                                                     \
@@ -308,7 +343,7 @@ public:
         src.prepareSSEEvaluation();                                                       \
     }
 
-/** Forwards prepareNeonEvaluation(), prepareAVXEvaluation() and prepareSSEEvaluation() if both source types supply them. */
+/** Forwards prepareNeonEvaluation(), prepareAVX512Evaluation(), prepareAVXEvaluation() and prepareSSEEvaluation() if both source types supply them. */
 #define VCTR_FORWARD_PREPARE_SIMD_EVALUATION_BINARY_EXPRESSION_MEMBER_FUNCTIONS(srcAName, srcBName)                               \
     void prepareNeonEvaluation() const                                                                                            \
     requires has::prepareNeonEvaluation<SrcAType> && has::prepareNeonEvaluation<SrcBType>                                         \
@@ -317,6 +352,13 @@ public:
         srcBName.prepareNeonEvaluation();                                                                                         \
     }                                                                                                                             \
                                                                                                                                   \
+    VCTR_FORCEDINLINE  VCTR_TARGET ("avx512f") void prepareAVX512Evaluation() const                                               \
+    requires has::prepareAVX512Evaluation<SrcAType> && has::prepareAVX512Evaluation<SrcBType>                                     \
+    {                                                                                                                             \
+        srcAName.prepareAVX512Evaluation();                                                                                       \
+        srcBName.prepareAVX512Evaluation();                                                                                       \
+    }                                                                                                                             \
+                                                                                                                                  \
     VCTR_FORCEDINLINE  VCTR_TARGET ("avx") void prepareAVXEvaluation() const                                                      \
     requires has::prepareAVXEvaluation<SrcAType> && has::prepareAVXEvaluation<SrcBType> && Expression::CommonElement::isRealFloat \
     {                                                                                                                             \
@@ -75,6 +75,29 @@ public:
     }
 };
 
+template <size_t extent, class SrcType>
+class AVX512Filter : public ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (AVX512Filter, src)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        return src[i];
+    }
+
+    //==============================================================================
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<value_type> getAVX512 (size_t i) const
+    requires (archX64 && has::getAVX512<SrcType>)
+    {
+        return src.getAVX512 (i);
+    }
+};
+
 template <size_t extent, class SrcType>
 class NeonFilter : public ExpressionTemplateBase
 {
@@ -119,6 +142,14 @@ constexpr inline ExpressionChainBuilder<expressions::SSEFilter> useSSE;
  */
 constexpr inline ExpressionChainBuilder<expressions::AVXFilter> useAVX;
 
+/** This filter expression ensures that only AVX512 based accelerated evaluation of the previous expression is possible.
+
+    If getAVX512 is not available on the source, this will only forward the basic operator[] based interface.
+
+    @ingroup Expressions
+ */
+constexpr inline ExpressionChainBuilder<expressions::AVX512Filter> useAVX512;
+
 /** This filter expression ensures that only Neon based accelerated evaluation of the previous expression is possible.
 
     If getNeon is not available on the source, this will only forward the basic operator[] based interface.
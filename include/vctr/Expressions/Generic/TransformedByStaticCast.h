@@ -48,11 +48,110 @@ public:
         const auto* s = src.evalNextVectorOpInExpressionChain (static_cast<ValueType<SrcType>*> (static_cast<void*> (dst)));
 
         const auto n = src.size();
-        for (size_t i = 0; i < n; ++i)
+        size_t i = 0;
+
+        if constexpr (isHalfPrecisionConversion)
+            i = convertHalfPrecision (s, dst, n);
+
+        for (; i < n; ++i)
             dst[i] = static_cast<DstValueType> (s[i]);
 
         return dst;
     }
+
+    //==============================================================================
+    // Only conversions from float16 and bfloat16 to float are SIMD accelerated as part of an expression chain. Their
+    // AVX versions would require F16C or AVX2 support, which can't be selected when evaluating a float expression.
+    VCTR_FORWARD_PREPARE_SIMD_EVALUATION_UNARY_EXPRESSION_MEMBER_FUNCTIONS
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") AVX512Register<float> getAVX512 (size_t i) const
+    requires Config::archX64 && is::anyVctr<SrcType> && is::halfPrecisionFloat<ValueType<SrcType>> && std::same_as<DstValueType, float>
+    {
+        return loadAVX512 (src.data() + i);
+    }
+
+private:
+    using SrcValueType = ValueType<SrcType>;
+
+    static constexpr bool isHalfPrecisionConversion = Config::archX64 && ((is::halfPrecisionFloat<SrcValueType> && std::same_as<DstValueType, float>) ||
+                                                                          (std::same_as<SrcValueType, float> && is::halfPrecisionFloat<DstValueType>));
+
+    /** Converts as many elements as possible with the best available instruction set and returns their number. */
+    static size_t convertHalfPrecision (const SrcValueType* s, DstValueType* d, size_t n)
+    {
+        if (Config::supportsAVX512)
+            return convertAVX512 (s, d, n);
+
+        constexpr bool isFloat16 = std::same_as<SrcValueType, float16> || std::same_as<DstValueType, float16>;
+
+        if constexpr (isFloat16)
+        {
+            if (Config::supportsF16C)
+                return convertF16C (s, d, n);
+        }
+        else
+        {
+            if (Config::supportsAVX2)
+                return convertAVX2 (s, d, n);
+        }
+
+        return 0;
+    }
+
+    //==============================================================================
+    // AVX512 Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static AVX512Register<float> loadAVX512 (const float* s) { return AVX512Register<float>::loadUnaligned (s); }
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static AVX512Register<float> loadAVX512 (const float16* s) { return AVX512Register<float>::loadFloat16 (s); }
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static AVX512Register<float> loadAVX512 (const bfloat16* s) { return AVX512Register<float>::loadBFloat16 (s); }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void storeAVX512 (AVX512Register<float> x, float* d) { x.storeUnaligned (d); }
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void storeAVX512 (AVX512Register<float> x, float16* d) { x.storeFloat16 (d); }
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx512f") static void storeAVX512 (AVX512Register<float> x, bfloat16* d) { x.storeBFloat16 (d); }
+
+    VCTR_TARGET ("avx512f") static size_t convertAVX512 (const SrcValueType* s, DstValueType* d, size_t n)
+    {
+        constexpr auto inc = AVX512Register<float>::numElements;
+
+        size_t i = 0;
+        for (; i + inc <= n; i += inc)
+            storeAVX512 (loadAVX512 (s + i), d + i);
+
+        return i;
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_TARGET ("avx,f16c") static size_t convertF16C (const SrcValueType* s, DstValueType* d, size_t n)
+    {
+        constexpr auto inc = AVXRegister<float>::numElements;
+
+        size_t i = 0;
+        for (; i + inc <= n; i += inc)
+        {
+            if constexpr (std::same_as<DstValueType, float>)
+                AVXRegister<float>::loadFloat16 (s + i).storeUnaligned (d + i);
+            else
+                AVXRegister<float>::loadUnaligned (s + i).storeFloat16 (d + i);
+        }
+
+        return i;
+    }
+
+    VCTR_TARGET ("avx2") static size_t convertAVX2 (const SrcValueType* s, DstValueType* d, size_t n)
+    {
+        constexpr auto inc = AVXRegister<float>::numElements;
+
+        size_t i = 0;
+        for (; i + inc <= n; i += inc)
+        {
+            if constexpr (std::same_as<DstValueType, float>)
+                AVXRegister<float>::loadBFloat16 (s + i).storeUnaligned (d + i);
+            else
+                AVXRegister<float>::loadUnaligned (s + i).storeBFloat16 (d + i);
+        }
+
+        return i;
+    }
 };
 
 } // namespace vctr::expressions
@@ -61,6 +160,10 @@ namespace vctr
 {
 /** Transforms all source elements to DstValueType by applying a static_cast<DstValueType> to them.
 
+    Conversions between float and float16 or bfloat16 are SIMD accelerated when a container is converted. Converting
+    a container of float16 or bfloat16 values to float also allows evaluating the rest of the expression chain with
+    AVX512.
+
     @ingroup Expressions
  */
 template <class DstType>
@@ -33,6 +33,8 @@ class ReductionExpression
 {
 public:
     //==============================================================================
+    /** The number of independent accumulators that the main loops of register wise reductions are unrolled into. */
+    static constexpr size_t numAccumulators = 4;
 
     /** Returns the reduction result of the expression passed in.
 
@@ -53,12 +55,18 @@ public:
                 return e.reduceVectorOp();
             }
 
-            if constexpr (has::reduceNeonRegisterWise<Expression, ValueType<Expression>>)
+            if constexpr (has::reduceNeonRegisterWise<Expression, ValueType<Expression>> || has::reduceNeonRegisterWiseCompensated<Expression, ValueType<Expression>>)
             {
                 return reduceNeon (e);
             }
 
-            if constexpr (has::reduceAVXRegisterWise<Expression, ValueType<Expression>>)
+            if constexpr (has::reduceAVX512RegisterWise<Expression, ValueType<Expression>> || has::reduceAVX512RegisterWiseCompensated<Expression, ValueType<Expression>>)
+            {
+                if (Config::supportsAVX512)
+                    return reduceAVX512 (e);
+            }
+
+            if constexpr (has::reduceAVXRegisterWise<Expression, ValueType<Expression>> || has::reduceAVXRegisterWiseCompensated<Expression, ValueType<Expression>>)
             {
                 if constexpr (is::realFloatNumber<ValueType<Expression>>)
                 {
@@ -72,136 +80,621 @@ public:
                 }
             }
 
-            if constexpr (has::reduceSSERegisterWise<Expression, ValueType<Expression>>)
+            if constexpr (has::reduceSSERegisterWise<Expression, ValueType<Expression>> || has::reduceSSERegisterWiseCompensated<Expression, ValueType<Expression>>)
             {
                 if (Config::highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
                     return reduceSSE (e);
             }
+
+            if constexpr (has::reduceNeonRegisterWiseMultiple<Expression>)
+            {
+                return reduceMultipleNeon (e);
+            }
+
+            if constexpr (has::reduceAVX512RegisterWiseMultiple<Expression>)
+            {
+                if (Config::supportsAVX512)
+                    return reduceMultipleAVX512 (e);
+            }
+
+            if constexpr (has::reduceAVXRegisterWiseMultiple<Expression>)
+            {
+                if (Config::supportsAVX)
+                    return reduceMultipleAVX (e);
+            }
+
+            if constexpr (has::reduceSSERegisterWiseMultiple<Expression>)
+            {
+                if (Config::highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+                    return reduceMultipleSSE (e);
+            }
+
+            if constexpr (has::reduceAVX512RegisterWiseWithIndex<Expression>)
+            {
+                if (Config::supportsAVX512)
+                    return reduceWithIndexAVX512 (e);
+            }
+
+            if constexpr (has::reduceAVXRegisterWiseWithIndex<Expression>)
+            {
+                if (Config::supportsAVX)
+                    return reduceWithIndexAVX (e);
+            }
+
+            if constexpr (has::reduceSSERegisterWiseWithIndex<Expression>)
+            {
+                if (Config::highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+                    return reduceWithIndexSSE (e);
+            }
         }
 
-        std::array<ValueType<Expression>, 1> v = { Expression::reductionResultInitValue };
-        for (size_t i = 0; i < s; ++i)
-            e.reduceElementWise (v[0], i);
+        return reduceElementWise (e);
+    }
+
+    /** Returns the reduction result of the expression passed in, evaluated on the threads of pool.
+
+        Large sources are split into a fixed number of chunks, which are reduced register wise by the threads. The
+        accumulator lanes of all chunks are then combined by a single finalizeReduction call in the order of the
+        chunks. Since neither the chunks nor the order in which their results are combined depend on the number of
+        threads, the result is bit identical for any pool on machines that use the same instruction set. It might
+        differ from the result of reduce though and machines with different instruction sets might also produce
+        slightly different results, since the number of accumulator lanes depends on the register size.
+
+        Expressions that can't be reduced register wise as well as sources that are too small to be split into chunks
+        are reduced by reduce on the calling thread. The vector operations of accelerated backends like IPP or Apple
+        Accelerate are not used by the parallel reduction. The expression must be safe to evaluate concurrently.
+     */
+    template <is::reductionExpression Expression>
+    static auto reduceParallel (const Expression& e, ThreadPool& pool)
+    {
+        if (e.size() >= numParallelReductionChunks * minParallelReductionChunkSize)
+        {
+            if constexpr (has::reduceNeonRegisterWise<Expression, ValueType<Expression>> || has::reduceNeonRegisterWiseCompensated<Expression, ValueType<Expression>>)
+            {
+                return reduceParallelNeon (e, pool);
+            }
+
+            if constexpr (has::reduceAVX512RegisterWise<Expression, ValueType<Expression>> || has::reduceAVX512RegisterWiseCompensated<Expression, ValueType<Expression>>)
+            {
+                if (Config::supportsAVX512)
+                    return reduceParallelAVX512 (e, pool);
+            }
+
+            if constexpr (has::reduceAVXRegisterWise<Expression, ValueType<Expression>> || has::reduceAVXRegisterWiseCompensated<Expression, ValueType<Expression>>)
+            {
+                if constexpr (is::realFloatNumber<ValueType<Expression>>)
+                {
+                    if (Config::supportsAVX)
+                        return reduceParallelAVX (e, pool);
+                }
+                else
+                {
+                    if (Config::supportsAVX2)
+                        return reduceParallelAVX2 (e, pool);
+                }
+            }
+
+            if constexpr (has::reduceSSERegisterWise<Expression, ValueType<Expression>> || has::reduceSSERegisterWiseCompensated<Expression, ValueType<Expression>>)
+            {
+                if (Config::highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+                    return reduceParallelSSE (e, pool);
+            }
+        }
 
-        return e.finalizeReduction (v);
+        return reduce (e);
     }
 
 private:
     //==============================================================================
+    // A fixed number of chunks keeps the parallel reduction results independent of the number of threads. The minimum
+    // chunk size ensures that every chunk holds at least a single register, even after rounding its size down to a
+    // multiple of the register size.
+    static constexpr size_t numParallelReductionChunks = 64;
+    static constexpr size_t minParallelReductionChunkSize = 4096;
+
     template <is::reductionExpression Expression>
-    VCTR_TARGET ("avx2") static auto reduceAVX2 (const Expression& e)
+    VCTR_FORCEDINLINE static constexpr auto reduceElementWise (const Expression& e)
+    {
+        const auto s = e.size();
+
+        if constexpr (has::reduceElementWiseCompensated<Expression, ValueType<Expression>>)
+        {
+            std::array<ValueType<Expression>, 2> v = { Expression::reductionResultInitValue, ValueType<Expression> (0) };
+            for (size_t i = 0; i < s; ++i)
+                e.reduceElementWise (v[0], v[1], i);
+
+            return e.finalizeReduction (v);
+        }
+        else
+        {
+            std::array<ValueType<Expression>, 1> v = { Expression::reductionResultInitValue };
+            for (size_t i = 0; i < s; ++i)
+                e.reduceElementWise (v[0], i);
+
+            return e.finalizeReduction (v);
+        }
+    }
+
+    //==============================================================================
+    // The entry points below only prepare the expression for the instruction set and define how a single register is
+    // reduced into an accumulator, as a lambda with the matching target attribute. Everything else is done by the
+    // instruction set independent drivers further down, which are parameterized on the register type and that step.
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx512f") static auto reduceAVX512 (const Expression& e)
     requires Config::archX64
     {
-        using VType = ValueType<Expression>;
-        using RType = AVXRegister<VType>;
+        e.prepareAVX512Evaluation();
+        return reduceRegisterWise<AVX512Register<ValueType<Expression>>, has::reduceAVX512RegisterWiseCompensated<Expression, ValueType<Expression>>> (e, reduceRangeAVX512<Expression>);
+    }
 
-        constexpr auto inc = RType::numElements;
-        const auto n = e.size();
-        const auto nSIMD = detail::previousMultipleOf<inc> (n);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx512f") static auto reduceParallelAVX512 (const Expression& e, ThreadPool& pool)
+    requires Config::archX64
+    {
+        e.prepareAVX512Evaluation();
+        return reduceRegisterWiseParallel<AVX512Register<ValueType<Expression>>, has::reduceAVX512RegisterWiseCompensated<Expression, ValueType<Expression>>> (e, pool, reduceRangeAVX512<Expression>);
+    }
 
-        e.prepareAVXEvaluation();
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx512f") static void reduceRangeAVX512 (const Expression& e, size_t begin, size_t end, ValueType<Expression>* results)
+    requires Config::archX64
+    {
+        constexpr auto compensated = has::reduceAVX512RegisterWiseCompensated<Expression, ValueType<Expression>>;
 
-        auto avxValue = RType::broadcast (Expression::reductionResultInitValue);
+        reduceRange<AVX512Register<ValueType<Expression>>, compensated, Expression> (begin, end, results, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("avx512f")
+        {
+            if constexpr (compensated)
+                e.reduceAVX512RegisterWise (accumulators[a], accumulators[numAccumulators + a], i);
+            else
+                e.reduceAVX512RegisterWise (accumulators[a], i);
+        });
+    }
 
-        size_t i = 0;
-        for (; i < nSIMD; i += inc)
-            e.reduceAVXRegisterWise (avxValue, i);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx512f") static size_t reduceWithIndexAVX512 (const Expression& e)
+    requires Config::archX64
+    {
+        using SType = typename Expression::SrcValueType;
+        using RType = AVX512Register<SType>;
 
-        alignas (Config::maxSIMDRegisterSize) std::array<VType, RType::numElements + 1> results;
-        avxValue.storeAligned (results.data());
-        results.back() = Expression::reductionResultInitValue;
+        e.prepareAVX512Evaluation();
+        return reduceWithIndex<RType> (e, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("avx512f")
+        {
+            e.reduceAVX512RegisterWise (accumulators[a], accumulators[numAccumulators + a], RType::broadcast (SType (i / RType::numElements)), i);
+        });
+    }
 
-        for (; i < n; ++i)
-            e.reduceElementWise (results.back(), i);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx512f") static auto reduceMultipleAVX512 (const Expression& e)
+    requires Config::archX64
+    {
+        e.prepareAVX512Evaluation();
+        return reduceMultiple<AVX512Register<typename Expression::SrcValueType>> (e, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("avx512f")
+        {
+            e.reduceAVX512RegisterWise (accumulators[a], i);
+        });
+    }
 
-        return e.finalizeReduction (results);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx2") static auto reduceAVX2 (const Expression& e)
+    requires Config::archX64
+    {
+        e.prepareAVXEvaluation();
+        return reduceRegisterWise<AVXRegister<ValueType<Expression>>, has::reduceAVXRegisterWiseCompensated<Expression, ValueType<Expression>>> (e, reduceRangeAVX2<Expression>);
     }
 
     template <is::reductionExpression Expression>
-    VCTR_TARGET ("avx") static auto reduceAVX (const Expression& e)
+    VCTR_TARGET ("avx2") static auto reduceParallelAVX2 (const Expression& e, ThreadPool& pool)
     requires Config::archX64
     {
-        using VType = ValueType<Expression>;
-        using RType = AVXRegister<VType>;
+        e.prepareAVXEvaluation();
+        return reduceRegisterWiseParallel<AVXRegister<ValueType<Expression>>, has::reduceAVXRegisterWiseCompensated<Expression, ValueType<Expression>>> (e, pool, reduceRangeAVX2<Expression>);
+    }
 
-        constexpr auto inc = RType::numElements;
-        const auto n = e.size();
-        const auto nSIMD = detail::previousMultipleOf<inc> (n);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx2") static void reduceRangeAVX2 (const Expression& e, size_t begin, size_t end, ValueType<Expression>* results)
+    requires Config::archX64
+    {
+        constexpr auto compensated = has::reduceAVXRegisterWiseCompensated<Expression, ValueType<Expression>>;
+
+        reduceRange<AVXRegister<ValueType<Expression>>, compensated, Expression> (begin, end, results, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("avx2")
+        {
+            if constexpr (compensated)
+                e.reduceAVXRegisterWise (accumulators[a], accumulators[numAccumulators + a], i);
+            else
+                e.reduceAVXRegisterWise (accumulators[a], i);
+        });
+    }
 
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx") static auto reduceAVX (const Expression& e)
+    requires Config::archX64
+    {
         e.prepareAVXEvaluation();
+        return reduceRegisterWise<AVXRegister<ValueType<Expression>>, has::reduceAVXRegisterWiseCompensated<Expression, ValueType<Expression>>> (e, reduceRangeAVX<Expression>);
+    }
 
-        auto avxValue = RType::broadcast (Expression::reductionResultInitValue);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx") static auto reduceParallelAVX (const Expression& e, ThreadPool& pool)
+    requires Config::archX64
+    {
+        e.prepareAVXEvaluation();
+        return reduceRegisterWiseParallel<AVXRegister<ValueType<Expression>>, has::reduceAVXRegisterWiseCompensated<Expression, ValueType<Expression>>> (e, pool, reduceRangeAVX<Expression>);
+    }
 
-        size_t i = 0;
-        for (; i < nSIMD; i += inc)
-            e.reduceAVXRegisterWise (avxValue, i);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx") static void reduceRangeAVX (const Expression& e, size_t begin, size_t end, ValueType<Expression>* results)
+    requires Config::archX64
+    {
+        constexpr auto compensated = has::reduceAVXRegisterWiseCompensated<Expression, ValueType<Expression>>;
 
-        alignas (Config::maxSIMDRegisterSize) std::array<VType, RType::numElements + 1> results;
-        avxValue.storeAligned (results.data());
-        results.back() = Expression::reductionResultInitValue;
+        reduceRange<AVXRegister<ValueType<Expression>>, compensated, Expression> (begin, end, results, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("avx")
+        {
+            if constexpr (compensated)
+                e.reduceAVXRegisterWise (accumulators[a], accumulators[numAccumulators + a], i);
+            else
+                e.reduceAVXRegisterWise (accumulators[a], i);
+        });
+    }
 
-        for (; i < n; ++i)
-            e.reduceElementWise (results.back(), i);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("avx") static size_t reduceWithIndexAVX (const Expression& e)
+    requires Config::archX64
+    {
+        using SType = typename Expression::SrcValueType;
+        using RType = AVXRegister<SType>;
 
-        return e.finalizeReduction (results);
+        e.prepareAVXEvaluation();
+        return reduceWithIndex<RType> (e, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("avx")
+        {
+            e.reduceAVXRegisterWise (accumulators[a], accumulators[numAccumulators + a], RType::broadcast (SType (i / RType::numElements)), i);
+        });
     }
 
     template <is::reductionExpression Expression>
-    VCTR_TARGET ("sse4.1") static auto reduceSSE (const Expression& e)
+    VCTR_TARGET ("avx") static auto reduceMultipleAVX (const Expression& e)
     requires Config::archX64
     {
-        using VType = ValueType<Expression>;
-        using RType = SSERegister<VType>;
+        e.prepareAVXEvaluation();
+        return reduceMultiple<AVXRegister<typename Expression::SrcValueType>> (e, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("avx")
+        {
+            e.reduceAVXRegisterWise (accumulators[a], i);
+        });
+    }
 
-        constexpr auto inc = RType::numElements;
-        const auto n = e.size();
-        const auto nSIMD = detail::previousMultipleOf<inc> (n);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("sse4.1") static auto reduceSSE (const Expression& e)
+    requires Config::archX64
+    {
+        e.prepareSSEEvaluation();
+        return reduceRegisterWise<SSERegister<ValueType<Expression>>, has::reduceSSERegisterWiseCompensated<Expression, ValueType<Expression>>> (e, reduceRangeSSE<Expression>);
+    }
 
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("sse4.1") static auto reduceParallelSSE (const Expression& e, ThreadPool& pool)
+    requires Config::archX64
+    {
         e.prepareSSEEvaluation();
+        return reduceRegisterWiseParallel<SSERegister<ValueType<Expression>>, has::reduceSSERegisterWiseCompensated<Expression, ValueType<Expression>>> (e, pool, reduceRangeSSE<Expression>);
+    }
 
-        auto sseValue = RType::broadcast (Expression::reductionResultInitValue);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("sse4.1") static void reduceRangeSSE (const Expression& e, size_t begin, size_t end, ValueType<Expression>* results)
+    requires Config::archX64
+    {
+        constexpr auto compensated = has::reduceSSERegisterWiseCompensated<Expression, ValueType<Expression>>;
 
-        size_t i = 0;
-        for (; i < nSIMD; i += inc)
-            e.reduceSSERegisterWise (sseValue, i);
+        reduceRange<SSERegister<ValueType<Expression>>, compensated, Expression> (begin, end, results, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("sse4.1")
+        {
+            if constexpr (compensated)
+                e.reduceSSERegisterWise (accumulators[a], accumulators[numAccumulators + a], i);
+            else
+                e.reduceSSERegisterWise (accumulators[a], i);
+        });
+    }
 
-        alignas (Config::maxSIMDRegisterSize) std::array<VType, RType::numElements + 1> results;
-        sseValue.storeAligned (results.data());
-        results.back() = Expression::reductionResultInitValue;
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("sse4.1") static size_t reduceWithIndexSSE (const Expression& e)
+    requires Config::archX64
+    {
+        using SType = typename Expression::SrcValueType;
+        using RType = SSERegister<SType>;
 
-        for (; i < n; ++i)
-            e.reduceElementWise (results.back(), i);
+        e.prepareSSEEvaluation();
+        return reduceWithIndex<RType> (e, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("sse4.1")
+        {
+            e.reduceSSERegisterWise (accumulators[a], accumulators[numAccumulators + a], RType::broadcast (SType (i / RType::numElements)), i);
+        });
+    }
 
-        return e.finalizeReduction (results);
+    template <is::reductionExpression Expression>
+    VCTR_TARGET ("sse4.1") static auto reduceMultipleSSE (const Expression& e)
+    requires Config::archX64
+    {
+        e.prepareSSEEvaluation();
+        return reduceMultiple<SSERegister<typename Expression::SrcValueType>> (e, [&] (auto& accumulators, size_t a, size_t i) VCTR_TARGET ("sse4.1")
+        {
+            e.reduceSSERegisterWise (accumulators[a], i);
+        });
     }
 
     template <is::reductionExpression Expression>
     static auto reduceNeon (const Expression& e)
     requires Config::archARM
+    {
+        e.prepareNeonEvaluation();
+        return reduceRegisterWise<NeonRegister<ValueType<Expression>>, has::reduceNeonRegisterWiseCompensated<Expression, ValueType<Expression>>> (e, reduceRangeNeon<Expression>);
+    }
+
+    template <is::reductionExpression Expression>
+    static auto reduceParallelNeon (const Expression& e, ThreadPool& pool)
+    requires Config::archARM
+    {
+        e.prepareNeonEvaluation();
+        return reduceRegisterWiseParallel<NeonRegister<ValueType<Expression>>, has::reduceNeonRegisterWiseCompensated<Expression, ValueType<Expression>>> (e, pool, reduceRangeNeon<Expression>);
+    }
+
+    template <is::reductionExpression Expression>
+    static void reduceRangeNeon (const Expression& e, size_t begin, size_t end, ValueType<Expression>* results)
+    requires Config::archARM
+    {
+        constexpr auto compensated = has::reduceNeonRegisterWiseCompensated<Expression, ValueType<Expression>>;
+
+        reduceRange<NeonRegister<ValueType<Expression>>, compensated, Expression> (begin, end, results, [&] (auto& accumulators, size_t a, size_t i)
+        {
+            if constexpr (compensated)
+                e.reduceNeonRegisterWise (accumulators[a], accumulators[numAccumulators + a], i);
+            else
+                e.reduceNeonRegisterWise (accumulators[a], i);
+        });
+    }
+
+    template <is::reductionExpression Expression>
+    static auto reduceMultipleNeon (const Expression& e)
+    requires Config::archARM
+    {
+        e.prepareNeonEvaluation();
+        return reduceMultiple<NeonRegister<typename Expression::SrcValueType>> (e, [&] (auto& accumulators, size_t a, size_t i)
+        {
+            e.reduceNeonRegisterWise (accumulators[a], i);
+        });
+    }
+
+    //==============================================================================
+    // Compensated reductions carry an additional compensation register per accumulator, which are placed behind the
+    // accumulators and handed to finalizeReduction as well.
+    template <bool compensated>
+    static constexpr size_t numAccumulatorRegisters = compensated ? 2 * numAccumulators : numAccumulators;
+
+    template <class RType, bool compensated, is::reductionExpression Expression, class ReduceRange>
+    static auto reduceRegisterWise (const Expression& e, ReduceRange&& reduceRange)
+    {
+        using VType = ValueType<Expression>;
+
+        // Sizes smaller than a single register are reduced element wise
+        if (e.size() < RType::numElements)
+            return reduceElementWise (e);
+
+        alignas (Config::maxSIMDRegisterSize) std::array<VType, numAccumulatorRegisters<compensated> * RType::numElements> results;
+        reduceRange (e, 0, e.size(), results.data());
+
+        return e.finalizeReduction (results);
+    }
+
+    template <class RType, bool compensated, is::reductionExpression Expression, class ReduceRange>
+    static auto reduceRegisterWiseParallel (const Expression& e, ThreadPool& pool, ReduceRange&& reduceRange)
     {
         using VType = ValueType<Expression>;
-        using RType = NeonRegister<VType>;
+
+        constexpr auto numLanes = numAccumulatorRegisters<compensated> * RType::numElements;
+        const auto n = e.size();
+        const auto chunkSize = detail::previousMultipleOf<RType::numElements> (n / numParallelReductionChunks);
+
+        // See reduceParallel for the chunks
+        alignas (Config::maxSIMDRegisterSize) std::array<VType, numParallelReductionChunks * numLanes> results;
+
+        pool.parallelFor (numParallelReductionChunks, [&] (size_t c)
+        {
+            const auto chunkEnd = c + 1 == numParallelReductionChunks ? n : (c + 1) * chunkSize;
+            reduceRange (e, c * chunkSize, chunkEnd, results.data() + c * numLanes);
+        });
+
+        return e.finalizeReduction (results);
+    }
+
+    //==============================================================================
+    // The drivers below operate on SIMD registers without carrying a target attribute. They are always inlined into
+    // the targeted entry points above, so they get compiled for the instruction set of their caller.
+
+    /** Calls reduceRegister (accumulators, a, i) for all registers that fit into the range [begin, end) and returns
+        the index behind the last one.
+
+        The loop is unrolled into independent accumulators, so that subsequent register wise reductions don't have to
+        wait for the latency of the previous one. Register r of the range is always reduced into the accumulator
+        a = r % numAccumulators, so every accumulator reduces its registers in order.
+     */
+    template <size_t inc, class Accumulators, class ReduceRegister>
+    VCTR_ALWAYSINLINE static size_t forEachRegister (Accumulators& accumulators, size_t begin, size_t end, ReduceRegister& reduceRegister)
+    {
+        const auto simdEnd = begin + detail::previousMultipleOf<inc> (end - begin);
+        const auto unrolledEnd = begin + detail::previousMultipleOf<numAccumulators * inc> (end - begin);
+
+        auto i = begin;
+        for (; i < unrolledEnd; i += numAccumulators * inc)
+        {
+            reduceRegister (accumulators, 0, i);
+            reduceRegister (accumulators, 1, i + inc);
+            reduceRegister (accumulators, 2, i + 2 * inc);
+            reduceRegister (accumulators, 3, i + 3 * inc);
+        }
+
+        for (size_t a = 0; i < simdEnd; i += inc, ++a)
+            reduceRegister (accumulators, a, i);
+
+        return i;
+    }
+
+    template <class RType, class T>
+    VCTR_ALWAYSINLINE static void storeRegister (const RType& r, T* d)
+    {
+        if constexpr (Config::archARM)
+            r.store (d);
+        else
+            r.storeAligned (d);
+    }
+
+    /** Reduces the elements in the range [begin, end) into the lanes of all accumulator registers and stores them to
+        results, which has to be aligned to the register size. The range has to hold at least a single register.
+     */
+    template <class RType, bool compensated, is::reductionExpression Expression, class ReduceRegister>
+    VCTR_ALWAYSINLINE static void reduceRange (size_t begin, size_t end, ValueType<Expression>* results, ReduceRegister&& reduceRegister)
+    {
+        using VType = ValueType<Expression>;
+
+        constexpr auto inc = RType::numElements;
+        constexpr auto numRegisters = numAccumulatorRegisters<compensated>;
+
+        std::array<RType, numRegisters> accumulators;
+        accumulators.fill (RType::broadcast (Expression::reductionResultInitValue));
+
+        for (auto a = numAccumulators; a < numRegisters; ++a)
+            accumulators[a] = RType::broadcast (VType (0));
+
+        const auto i = forEachRegister<inc> (accumulators, begin, end, reduceRegister);
+
+        for (size_t a = 0; a < numRegisters; ++a)
+            storeRegister (accumulators[a], results + a * inc);
+
+        if (i < end)
+        {
+            // The remaining elements are reduced by a final register that overlaps with the last full one. Only the
+            // lanes holding elements that have not been reduced in the main loop are taken over into the results.
+            auto tailValues = accumulators;
+            reduceRegister (tailValues, 0, end - inc);
+
+            alignas (Config::maxSIMDRegisterSize) std::array<VType, inc> tail;
+
+            // Only the first accumulator and its compensation register are changed by the tail
+            for (size_t a = 0; a < numRegisters; a += numAccumulators)
+            {
+                storeRegister (tailValues[a], tail.data());
+
+                for (auto lane = inc - (end - i); lane < inc; ++lane)
+                    results[a * inc + lane] = tail[lane];
+            }
+        }
+    }
+
+    template <class RType, is::reductionExpression Expression, class ReduceRegister>
+    VCTR_ALWAYSINLINE static size_t reduceWithIndex (const Expression& e, ReduceRegister&& reduceRegister)
+    {
+        using SType = typename Expression::SrcValueType;
 
         constexpr auto inc = RType::numElements;
+        constexpr auto maxNumRegisters = size_t (1) << std::numeric_limits<SType>::digits;
         const auto n = e.size();
-        const auto nSIMD = detail::previousMultipleOf<inc> (n);
 
-        e.prepareNeonEvaluation();
+        // Register indices are counted in the source value type, which represents integers exactly only up to
+        // 2^digits. Sizes smaller than a single register are reduced element wise as well.
+        if (n < inc || n / inc > maxNumRegisters)
+            return reduceElementWise (e);
+
+        // Each accumulator lane keeps the best value seen in that lane along with the index of the register that
+        // held it, which the step computes as i / inc. Equal values are not taken over, so the first best value is
+        // kept. Like compensation registers, the register indices are placed behind the accumulators.
+        std::array<RType, 2 * numAccumulators> accumulators;
 
-        auto neonValue = RType::broadcast (Expression::reductionResultInitValue);
+        for (size_t a = 0; a < numAccumulators; ++a)
+        {
+            accumulators[a] = RType::broadcast (Expression::indexReductionInitValue);
+            accumulators[numAccumulators + a] = RType::broadcast (SType (-1));
+        }
 
-        size_t i = 0;
-        for (; i < nSIMD; i += inc)
-            e.reduceNeonRegisterWise (neonValue, i);
+        const auto nSIMD = forEachRegister<inc> (accumulators, 0, n, reduceRegister);
 
-        alignas (Config::maxSIMDRegisterSize) std::array<VType, RType::numElements + 1> results;
-        neonValue.store (results.data());
-        results.back() = Expression::reductionResultInitValue;
+        alignas (Config::maxSIMDRegisterSize) std::array<SType, numAccumulators * inc> laneRegisterIndices;
+
+        for (size_t a = 0; a < numAccumulators; ++a)
+            storeRegister (accumulators[numAccumulators + a], laneRegisterIndices.data() + a * inc);
+
+        return finalizeIndexReduction<inc> (e, laneRegisterIndices, nSIMD);
+    }
+
+    template <class RType, is::reductionExpression Expression, class ReduceRegister>
+    VCTR_ALWAYSINLINE static auto reduceMultiple (const Expression& e, ReduceRegister&& reduceRegister)
+    {
+        using VType = ValueType<Expression>;
+        using SType = typename Expression::SrcValueType;
+
+        constexpr auto inc = RType::numElements;
+        constexpr auto numValues = std::tuple_size<VType>::value;
+        const auto n = e.size();
+
+        if (n < inc)
+            return reduceElementWise (e);
+
+        // Expressions that reduce into multiple values keep one accumulator register per value and the main loop is
+        // unrolled into independent sets of these. The lanes of all sets are transposed into one partial result per
+        // lane afterwards and the remaining elements are reduced element wise into an additional last partial result.
+        std::array<std::array<RType, numValues>, numAccumulators> accumulators;
+
+        for (auto& set : accumulators)
+            for (size_t v = 0; v < numValues; ++v)
+                set[v] = RType::broadcast (Expression::reductionResultInitValue[v]);
+
+        auto i = forEachRegister<inc> (accumulators, 0, n, reduceRegister);
+
+        alignas (Config::maxSIMDRegisterSize) std::array<SType, inc> lanes;
+        std::array<VType, numAccumulators * inc + 1> partialResults;
+
+        for (size_t a = 0; a < numAccumulators; ++a)
+        {
+            for (size_t v = 0; v < numValues; ++v)
+            {
+                storeRegister (accumulators[a][v], lanes.data());
+
+                for (size_t lane = 0; lane < inc; ++lane)
+                    partialResults[a * inc + lane][v] = lanes[lane];
+            }
+        }
+
+        partialResults.back() = Expression::reductionResultInitValue;
 
         for (; i < n; ++i)
-            e.reduceElementWise (results.back(), i);
+            e.reduceElementWise (partialResults.back(), i);
 
-        return e.finalizeReduction (results);
+        return e.finalizeReduction (partialResults);
+    }
+
+    /** Combines the lanes of a register wise index reduction and reduces the remaining elements behind nSIMD.
+
+        Lane l holds the index of the register in which the best value of the lane l % inc was found or -1 if
+        no value was taken over. The candidate element indices are compared in ascending order by the element
+        wise reduction of the expression, so that the first one of equal values is kept.
+     */
+    template <size_t inc, class Expression, class SType, size_t numLanes>
+    static size_t finalizeIndexReduction (const Expression& e, const std::array<SType, numLanes>& laneRegisterIndices, size_t nSIMD)
+    {
+        std::array<size_t, numLanes> candidates;
+        size_t numCandidates = 0;
+
+        for (size_t l = 0; l < numLanes; ++l)
+        {
+            if (laneRegisterIndices[l] >= SType (0))
+                candidates[numCandidates++] = size_t (laneRegisterIndices[l]) * inc + l % inc;
+        }
+
+        std::sort (candidates.begin(), candidates.begin() + numCandidates);
+
+        size_t result = numCandidates > 0 ? candidates[0] : 0;
+
+        for (size_t c = 1; c < numCandidates; ++c)
+            e.reduceElementWise (result, candidates[c]);
+
+        for (auto i = nSIMD; i < e.size(); ++i)
+            e.reduceElementWise (result, i);
+
+        return result;
     }
 };
 
@@ -0,0 +1,172 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2023 by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::detail
+{
+
+/** Computes the sine and the cosine of all source elements by calling sinCosRegister for each register of inc
+    elements. Sizes below a single register are computed element wise.
+ */
+template <size_t inc, class Src, class T, class SinCosRegister>
+VCTR_ALWAYSINLINE void sinCosRegisterWise (const Src& src, T* s, T* c, SinCosRegister&& sinCosRegister)
+{
+    const auto n = src.size();
+
+    if (n < inc)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            s[i] = std::sin (src[i]);
+            c[i] = std::cos (src[i]);
+        }
+
+        return;
+    }
+
+    const auto nSIMD = previousMultipleOf<inc> (n);
+
+    for (size_t i = 0; i < nSIMD; i += inc)
+        sinCosRegister (i);
+
+    // The remaining elements are computed by a final register that overlaps with the last full one. Since the
+    // destinations don't overlap with the source, the overlapping elements are simply computed twice.
+    if (nSIMD < n)
+        sinCosRegister (n - inc);
+}
+
+template <class Src, class SinDst, class CosDst>
+VCTR_TARGET ("avx512f")
+void sinCosAVX512 (const Src& src, SinDst& sinDst, CosDst& cosDst)
+requires Config::archX64
+{
+    using RType = AVX512Register<typename Src::value_type>;
+
+    src.prepareAVX512Evaluation();
+    auto* s = sinDst.data();
+    auto* c = cosDst.data();
+
+    sinCosRegisterWise<RType::numElements> (src, s, c, [&] (size_t i) VCTR_TARGET ("avx512f")
+    {
+        const auto [sinX, cosX] = RType::sinCos (src.getAVX512 (i));
+        sinX.storeUnaligned (s + i);
+        cosX.storeUnaligned (c + i);
+    });
+}
+
+template <class Src, class SinDst, class CosDst>
+VCTR_TARGET ("avx")
+void sinCosAVX (const Src& src, SinDst& sinDst, CosDst& cosDst)
+requires Config::archX64
+{
+    using RType = AVXRegister<typename Src::value_type>;
+
+    src.prepareAVXEvaluation();
+    auto* s = sinDst.data();
+    auto* c = cosDst.data();
+
+    sinCosRegisterWise<RType::numElements> (src, s, c, [&] (size_t i) VCTR_TARGET ("avx")
+    {
+        const auto [sinX, cosX] = RType::sinCos (src.getAVX (i));
+        sinX.storeUnaligned (s + i);
+        cosX.storeUnaligned (c + i);
+    });
+}
+
+template <class Src, class SinDst, class CosDst>
+VCTR_TARGET ("sse4.1")
+void sinCosSSE4_1 (const Src& src, SinDst& sinDst, CosDst& cosDst)
+requires Config::archX64
+{
+    using RType = SSERegister<typename Src::value_type>;
+
+    src.prepareSSEEvaluation();
+    auto* s = sinDst.data();
+    auto* c = cosDst.data();
+
+    sinCosRegisterWise<RType::numElements> (src, s, c, [&] (size_t i) VCTR_TARGET ("sse4.1")
+    {
+        const auto [sinX, cosX] = RType::sinCos (src.getSSE (i));
+        sinX.storeUnaligned (s + i);
+        cosX.storeUnaligned (c + i);
+    });
+}
+
+} // namespace vctr::detail
+
+namespace vctr
+{
+
+/** Computes the sine and the cosine of each source element in a single pass and writes them to sinDst and cosDst.
+
+    The source can be a Vector, Array, Span or an expression. Compared to assigning vctr::sin and vctr::cos
+    separately, a source expression is evaluated only once and on x64 the argument reduction is shared between both
+    functions. Both destinations must have the same size as the source and must not overlap with it.
+
+    @ingroup Expressions
+ */
+template <is::anyVctrOrExpression Src, is::anyVctr SinDst, is::anyVctr CosDst>
+requires is::realFloatNumber<ValueType<Src>> && std::same_as<ValueType<Src>, ValueType<SinDst>> && std::same_as<ValueType<Src>, ValueType<CosDst>>
+void sinCos (const Src& src, SinDst&& sinDst, CosDst&& cosDst)
+{
+    assertCommonSize (src, sinDst);
+    assertCommonSize (src, cosDst);
+
+    if constexpr (Config::archX64)
+    {
+        if constexpr (has::getAVX512<Src>)
+        {
+            if (Config::supportsAVX512)
+            {
+                detail::sinCosAVX512 (src, sinDst, cosDst);
+                return;
+            }
+        }
+
+        if constexpr (has::getAVX<Src>)
+        {
+            if (Config::supportsAVX)
+            {
+                detail::sinCosAVX (src, sinDst, cosDst);
+                return;
+            }
+        }
+
+        if constexpr (has::getSSE<Src>)
+        {
+            if (Config::highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+            {
+                detail::sinCosSSE4_1 (src, sinDst, cosDst);
+                return;
+            }
+        }
+    }
+
+    const auto n = src.size();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        sinDst[i] = std::sin (src[i]);
+        cosDst[i] = std::cos (src[i]);
+    }
+}
+
+} // namespace vctr
@@ -22,6 +22,85 @@
 
 namespace vctr
 {
+namespace detail
+{
+
+/** Passed to the construct function of an allocator to default initialise an element instead of value initialising it,
+    which leaves trivially default constructible elements uninitialised.
+ */
+struct DefaultInitialisedElement
+{
+    /** Range insert implementations of std::vector also contain code paths that assign the inserted elements to
+        existing ones, which are not taken when inserting at the end but need to compile.
+     */
+    template <class T>
+    requires std::is_trivially_default_constructible_v<T>
+    constexpr operator T() const { return T {}; }
+};
+
+/** A forward iterator over a number of DefaultInitialisedElement instances, which allows growing a std::vector without
+    initialising the new elements by passing a range of them to its range insert function. All positions refer to the
+    same element, so that dereferencing yields a real reference as required for forward iterators.
+ */
+class DefaultInitialisedElementIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = DefaultInitialisedElement;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const DefaultInitialisedElement*;
+    using reference = const DefaultInitialisedElement&;
+
+    constexpr DefaultInitialisedElementIterator() = default;
+    constexpr explicit DefaultInitialisedElementIterator (size_t idx) : i (idx) {}
+
+    constexpr reference operator*() const { return element; }
+
+    constexpr DefaultInitialisedElementIterator& operator++() { ++i; return *this; }
+    constexpr DefaultInitialisedElementIterator operator++ (int) { auto prev = *this; ++i; return prev; }
+
+    constexpr bool operator== (const DefaultInitialisedElementIterator& other) const = default;
+
+private:
+    static constexpr DefaultInitialisedElement element {};
+
+    size_t i = 0;
+};
+
+static_assert (std::forward_iterator<DefaultInitialisedElementIterator>);
+
+template <class Storage>
+constexpr bool canGrowUninitialised = false;
+
+/** True for a std::vector or a type derived from it, if its elements are trivially default constructible and its
+    allocator can construct them from a DefaultInitialisedElement.
+ */
+template <class Storage>
+requires std::derived_from<Storage, std::vector<typename Storage::value_type, typename Storage::allocator_type>>
+constexpr bool canGrowUninitialised<Storage> = std::is_trivially_default_constructible_v<typename Storage::value_type> &&
+                                               requires (typename Storage::allocator_type& a, typename Storage::value_type* ptr) { a.construct (ptr, DefaultInitialisedElement {}); };
+
+/** Resizes storage like its resize member function, but leaves new elements uninitialised if canGrowUninitialised
+    is true for it.
+ */
+template <class Storage>
+constexpr void resizeUninitialized (Storage& storage, size_t newSize)
+{
+    if constexpr (canGrowUninitialised<Storage>)
+    {
+        if (newSize > storage.size())
+        {
+            auto& v = static_cast<std::vector<typename Storage::value_type, typename Storage::allocator_type>&> (storage);
+            v.insert (v.end(), DefaultInitialisedElementIterator (0), DefaultInitialisedElementIterator (newSize - v.size()));
+            return;
+        }
+    }
+
+    storage.resize (newSize);
+}
+
+} // namespace detail
+
 /** Returns aligned pointers when allocations are requested. */
 template <typename ElementType, size_t alignmentInBytes>
 requires (alignmentInBytes >= alignof (ElementType) && is::powerOfTwoInt<alignmentInBytes>)
@@ -67,6 +146,19 @@ public:
 #endif
     }
 
+    /** Default initialises the element, which leaves trivially default constructible elements uninitialised.
+
+        This is only used when a Vector grows without initialising its elements, all other constructions are performed
+        by std::allocator_traits, so that a std::vector using this allocator still value initialises new elements.
+
+        @see Vector::resizeUninitialized
+     */
+    template <class T>
+    void construct (T* ptr, detail::DefaultInitialisedElement) noexcept (std::is_nothrow_default_constructible_v<T>)
+    {
+        ::new (static_cast<void*> (ptr)) T;
+    }
+
     template <class T>
     struct rebind
     {
@@ -80,4 +172,92 @@ constexpr bool operator== (const AlignedAllocator<ElementType, alignmentInBytesL
     return alignmentInBytesLHS == alignmentInBytesRHS;
 }
 
+/** An AlignedAllocator variant for large buffers that are processed by several threads on NUMA machines.
+
+    Operating systems usually place a memory page on the NUMA node of the thread that writes to it first. This
+    allocator requests fresh pages from the operating system for all allocations of at least a page, which are not
+    touched before the elements are initialised. Like with the AlignedAllocator, a Vector using it can grow without
+    touching the pages of arithmetic elements. Initialise the elements from the threads that will later work on them to
+    place the pages on their NUMA nodes, e.g. by creating a Vector with a ThreadPool.
+
+    The pages are requested via mmap on unix platforms and via VirtualAlloc on Windows.
+ */
+template <typename ElementType, size_t alignmentInBytes>
+requires (alignmentInBytes >= alignof (ElementType) && is::powerOfTwoInt<alignmentInBytes>)
+class NumaLocalAllocator : public AlignedAllocator<ElementType, alignmentInBytes>
+{
+public:
+    using value_type = ElementType;
+    using size_type = std::size_t;
+
+    NumaLocalAllocator() noexcept = default;
+
+    template <class OtherElementType>
+    NumaLocalAllocator (const NumaLocalAllocator<OtherElementType, alignmentInBytes>&) noexcept {}
+
+    [[nodiscard]] ElementType* allocate (size_t nElementsToAllocate)
+    {
+        if (nElementsToAllocate >= minNumElementsForPageAllocation)
+        {
+            if (nElementsToAllocate > std::numeric_limits<size_t>::max() / sizeof (ElementType))
+                throw std::bad_array_new_length();
+
+#if VCTR_WINDOWS
+            auto* ptr = VirtualAlloc (nullptr, nElementsToAllocate * sizeof (ElementType), MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            if (ptr == nullptr)
+                throw std::bad_alloc();
+#else
+            auto* ptr = mmap (nullptr, nElementsToAllocate * sizeof (ElementType), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr == MAP_FAILED)
+                throw std::bad_alloc();
+#endif
+
+            return reinterpret_cast<ElementType*> (ptr);
+        }
+
+        return AlignedAllocator<ElementType, alignmentInBytes>::allocate (nElementsToAllocate);
+    }
+
+    void deallocate (ElementType* allocatedPointer, size_t nElementsAllocated)
+    {
+        if (nElementsAllocated >= minNumElementsForPageAllocation)
+        {
+#if VCTR_WINDOWS
+            VirtualFree (allocatedPointer, 0, MEM_RELEASE);
+#else
+            munmap (allocatedPointer, nElementsAllocated * sizeof (ElementType));
+#endif
+            return;
+        }
+
+        AlignedAllocator<ElementType, alignmentInBytes>::deallocate (allocatedPointer, nElementsAllocated);
+    }
+
+    template <class T>
+    struct rebind
+    {
+        using other = NumaLocalAllocator<T, alignmentInBytes>;
+    };
+
+private:
+    // Page allocations are aligned to the page size, which is at least 4 kB on all supported platforms. Their size is
+    // rounded up to a multiple of the page size, so they are also extended to a multiple of the SIMD register size.
+    static constexpr size_t minNumElementsForPageAllocation = std::max (size_t (4096) / sizeof (ElementType), size_t (1));
+    static_assert (alignmentInBytes <= 4096);
+};
+
+template <class ElementType, size_t alignmentInBytesLHS, size_t alignmentInBytesRHS>
+constexpr bool operator== (const NumaLocalAllocator<ElementType, alignmentInBytesLHS>&, const NumaLocalAllocator<ElementType, alignmentInBytesRHS>&)
+{
+    return alignmentInBytesLHS == alignmentInBytesRHS;
+}
+
+/** A NumaLocalAllocator with an alignment suitable for SIMD access, to be passed as allocator to a Vector, e.g. like
+    @code
+    Vector<float, NumaLocalVectorAllocator> v (numElements, threadPool);
+    @endcode
+ */
+template <class ElementType>
+using NumaLocalVectorAllocator = NumaLocalAllocator<ElementType, Config::maxSIMDRegisterSize>;
+
 } // namespace vctr
@@ -29,8 +29,10 @@
 #endif
 
 // VCTR_FORCEDINLINE enforces full inlining in release builds. In debug builds we want to preserve the possibility
-// to debug, so it does not affect inlining there
-#if VCTR_DEBUG
+// to debug, so it does not affect inlining there. An exception are optimised GCC builds: GCC inserts a vzeroupper
+// before returning a SIMD register wrapper struct from an out-of-line function, which clears the upper lanes of the
+// returned value. Since unoptimised builds don't insert vzeroupper at all, only these need the forced inlining.
+#if VCTR_DEBUG && ! (VCTR_GCC && defined (__OPTIMIZE__))
 #define VCTR_FORCEDINLINE
 #else
 #if VCTR_MSVC
@@ -40,6 +42,15 @@
 #endif
 #endif
 
+// VCTR_ALWAYSINLINE enforces inlining in all builds. It is meant for instruction set independent helpers that operate
+// on SIMD registers without carrying a target attribute, which only compile for the target of the caller they are
+// inlined into.
+#if VCTR_MSVC
+#define VCTR_ALWAYSINLINE __forceinline
+#else
+#define VCTR_ALWAYSINLINE inline __attribute__ ((always_inline))
+#endif
+
 
 #if (VCTR_GCC || VCTR_CLANG)
 
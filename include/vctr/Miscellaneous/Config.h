@@ -59,7 +59,17 @@
 #else
 #define VCTR_ARM 0
 #define VCTR_X64 1
-#define VCTR_MAX_SIMD_REGISTER_SIZE 32
+#define VCTR_MAX_SIMD_REGISTER_SIZE 64
+#endif
+
+// Fused multiply add instructions are only emitted by the SIMD code paths if the translation unit is compiled with FMA
+// support, e.g. through -mfma, -march=haswell or /arch:AVX2. Although AVX-512F always includes them, this applies to
+// the AVX-512 code paths as well, so that the rounding of results doesn't depend on the instruction set picked at
+// runtime.
+#if VCTR_X64 && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define VCTR_FMA 1
+#else
+#define VCTR_FMA 0
 #endif
 
 //==============================================================================
@@ -151,6 +161,7 @@ enum class CPUInstructionSet
     sse4_1,
     avx,
     avx2,
+    avx512,
 
     neon,
 
@@ -232,6 +243,7 @@ public:
     static bool hasAVX() { return cpuFeatures.f_1_ECX_[28]; }
     static bool hasAVX2() { return cpuFeatures.f_7_EBX_[5]; }
     static bool hasAVX512F() { return cpuFeatures.f_7_EBX_[16]; }
+    static bool hasF16C() { return cpuFeatures.f_1_ECX_[29]; }
 
 private:
 };
@@ -239,6 +251,9 @@ private:
 
 inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
 {
+    if (detail::X64InstructionSets::hasAVX512F())
+        return CPUInstructionSet::avx512;
+
     if (detail::X64InstructionSets::hasAVX2())
         return CPUInstructionSet::avx2;
 
@@ -251,6 +266,11 @@ inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
     return CPUInstructionSet::fallback;
 }
 
+inline bool cpuSupportsF16C()
+{
+    return detail::X64InstructionSets::hasF16C();
+}
+
 #elif VCTR_ARM
 
 inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
@@ -258,12 +278,20 @@ inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
     return CPUInstructionSet::neon;
 }
 
+inline bool cpuSupportsF16C()
+{
+    return false;
+}
+
 #else
 
 inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
 {
     __builtin_cpu_init();
 
+    if (__builtin_cpu_supports ("avx512f"))
+        return CPUInstructionSet::avx512;
+
     if (__builtin_cpu_supports ("avx2"))
         return CPUInstructionSet::avx2;
 
@@ -276,6 +304,13 @@ inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
     return CPUInstructionSet::fallback;
 }
 
+inline bool cpuSupportsF16C()
+{
+    __builtin_cpu_init();
+
+    return __builtin_cpu_supports ("f16c");
+}
+
 #endif
 
 namespace detail
@@ -294,9 +329,16 @@ struct Config
 {
     static const inline auto highestSupportedCPUInstructionSet = getHighestSupportedCPUInstructionSet();
 
-    static const inline auto supportsAVX2 = highestSupportedCPUInstructionSet == CPUInstructionSet::avx2;
+    static const inline auto supportsAVX512 = highestSupportedCPUInstructionSet == CPUInstructionSet::avx512;
+
+    static const inline auto supportsAVX2 = supportsAVX512 || highestSupportedCPUInstructionSet == CPUInstructionSet::avx2;
 
-    static const inline auto supportsAVX = highestSupportedCPUInstructionSet == CPUInstructionSet::avx2 || highestSupportedCPUInstructionSet == CPUInstructionSet::avx;
+    static const inline auto supportsAVX = supportsAVX2 || highestSupportedCPUInstructionSet == CPUInstructionSet::avx;
+
+    /** The F16C half precision conversion instructions are available on all CPUs supporting AVX2, but not on all that
+        only support AVX.
+     */
+    static const inline auto supportsF16C = supportsAVX && cpuSupportsF16C();
 
     //==============================================================================
     // Platform config
@@ -320,6 +362,8 @@ struct Config
 
     static_assert (detail::trueCount<archARM, archX64>() == 1, "Unsupported architecture or architecture detection error");
 
+    static constexpr bool hasFMA = VCTR_FMA;
+
     //==============================================================================
     // Compiler config
     //==============================================================================
@@ -0,0 +1,167 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** A 16 bit IEEE 754 half precision floating point value with 5 exponent and 10 mantissa bits.
+
+    It is meant as a compact storage type, e.g. for large buffers that are kept in memory, and does not define any
+    arithmetic on its own. A float16 converts implicitly to float, so that all math is carried out in single precision,
+    while a float only converts explicitly to float16, rounding to the nearest representable value. Values outside the
+    range of ±65504 become infinite.
+
+    Use transformedByStaticCastTo<float> to use a container of float16 values in a SIMD accelerated expression and
+    transformedByStaticCastTo<float16> to convert float values back. Both use the F16C or AVX512 conversion
+    instructions if available.
+ */
+class float16
+{
+public:
+    float16() = default;
+
+    constexpr explicit float16 (float value) : bits (fromFloat (value)) {}
+
+    constexpr operator float() const { return toFloat (bits); }
+
+    /** Creates a value from its binary representation. */
+    static constexpr float16 fromBits (uint16_t b)
+    {
+        float16 f;
+        f.bits = b;
+        return f;
+    }
+
+    /** Returns the binary representation. */
+    constexpr uint16_t toBits() const { return bits; }
+
+private:
+    uint16_t bits;
+
+    static constexpr float toFloat (uint16_t h)
+    {
+        const auto sign = uint32_t (h & 0x8000) << 16;
+        const auto exponent = uint32_t (h >> 10) & 0x1f;
+        const auto mantissa = uint32_t (h & 0x3ff);
+
+        if (exponent == 0x1f)
+            return std::bit_cast<float> (sign | 0x7f800000 | (mantissa << 13));
+
+        // Subnormal values are no subnormals in single precision, their value is mantissa * 2^-24
+        if (exponent == 0)
+        {
+            const auto magnitude = float (mantissa) * 0x1p-24f;
+            return sign != 0 ? -magnitude : magnitude;
+        }
+
+        return std::bit_cast<float> (sign | ((exponent + 112) << 23) | (mantissa << 13));
+    }
+
+    /** Rounds to the nearest even value, like the F16C instructions do. */
+    static constexpr uint16_t fromFloat (float f)
+    {
+        const auto bits = std::bit_cast<uint32_t> (f);
+        const auto sign = uint16_t ((bits >> 16) & 0x8000);
+        const auto magnitude = bits & 0x7fffffff;
+
+        // NaNs keep the upper mantissa bits and become quiet NaNs
+        if (magnitude > 0x7f800000)
+            return uint16_t (sign | 0x7e00 | ((magnitude >> 13) & 0x3ff));
+
+        // 65520 is the first value that is closer to infinity than to the largest finite value
+        if (magnitude >= 0x477ff000)
+            return uint16_t (sign | 0x7c00);
+
+        // Values below the smallest normal value 2^-14 become subnormal
+        if (magnitude < 0x38800000)
+        {
+            const auto shift = 126 - int (magnitude >> 23);
+
+            if (shift > 24)
+                return sign;
+
+            const auto mantissa = (magnitude & 0x7fffff) | 0x800000;
+            return uint16_t (sign | roundShiftedBits (mantissa, shift));
+        }
+
+        return uint16_t (sign | roundShiftedBits (magnitude - (uint32_t (112) << 23), 13));
+    }
+
+    /** Shifts the bits right, rounding to the nearest even value. */
+    static constexpr uint16_t roundShiftedBits (uint32_t bits, int shift)
+    {
+        const auto half = uint32_t (1) << (shift - 1);
+        const auto remainder = bits & ((half << 1) - 1);
+        auto result = bits >> shift;
+
+        if (remainder > half || (remainder == half && (result & 1) != 0))
+            ++result;
+
+        return uint16_t (result);
+    }
+};
+
+/** A 16 bit brain floating point value, which has the 8 bit exponent of a float but only 7 mantissa bits.
+
+    It covers the whole range of float at a lower precision than float16 and is meant as compact storage type as well.
+    A bfloat16 converts implicitly to float and a float only explicitly to bfloat16, rounding to the nearest
+    representable value.
+
+    @see float16
+ */
+class bfloat16
+{
+public:
+    bfloat16() = default;
+
+    constexpr explicit bfloat16 (float value) : bits (fromFloat (value)) {}
+
+    constexpr operator float() const { return std::bit_cast<float> (uint32_t (bits) << 16); }
+
+    /** Creates a value from its binary representation. */
+    static constexpr bfloat16 fromBits (uint16_t b)
+    {
+        bfloat16 f;
+        f.bits = b;
+        return f;
+    }
+
+    /** Returns the binary representation. */
+    constexpr uint16_t toBits() const { return bits; }
+
+private:
+    uint16_t bits;
+
+    /** Rounds to the nearest even value. */
+    static constexpr uint16_t fromFloat (float f)
+    {
+        const auto bits = std::bit_cast<uint32_t> (f);
+
+        // NaNs are truncated and made quiet, so that rounding can't turn them into infinity
+        if ((bits & 0x7fffffff) > 0x7f800000)
+            return uint16_t ((bits | 0x400000) >> 16);
+
+        return uint16_t ((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+    }
+};
+
+} // namespace vctr
@@ -0,0 +1,212 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** A small work stealing pool of worker threads to evaluate large expressions or batches of expressions in parallel.
+
+    The threads are started once when constructing the pool and wait for work until it is destroyed, so that no thread
+    has to be created for a parallel evaluation. The calling thread always takes part in the work, so a pool created
+    with numThreads threads only starts numThreads - 1 worker threads. All memory needed for scheduling is allocated
+    on construction, so that neither the calling thread nor the workers allocate while running tasks.
+
+    @ingroup Core
+ */
+class ThreadPool
+{
+public:
+    /** Creates a pool that evaluates on numThreads threads in total, including the calling thread. */
+    explicit ThreadPool (size_t numThreads = std::thread::hardware_concurrency())
+        : taskRanges (std::max (numThreads, size_t (1)))
+    {
+        for (size_t i = 1; i < numThreads; ++i)
+            workers.emplace_back ([this, i] { workerLoop (i); });
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock (mutex);
+            shouldExit = true;
+        }
+
+        workAvailable.notify_all();
+
+        for (auto& w : workers)
+            w.join();
+    }
+
+    ThreadPool (const ThreadPool&) = delete;
+    ThreadPool& operator= (const ThreadPool&) = delete;
+
+    /** Returns the number of threads that take part in the work, including the calling thread. */
+    size_t getNumThreads() const { return workers.size() + 1; }
+
+    /** Calls fn (i) for all i in [0, numTasks) on the worker threads and the calling thread and returns after all calls
+        have finished.
+
+        Each thread starts with a contiguous range of task indices, which it works through in ascending order. Threads
+        that run out of tasks steal the upper half of the remaining range of another thread, so that tasks of different
+        durations are balanced across the threads. fn must not throw and it must be safe to call it concurrently. This
+        must not be called by several threads at the same time or from within a task.
+     */
+    template <class Fn>
+    void parallelFor (size_t numTasks, const Fn& fn)
+    {
+        if (workers.empty() || numTasks < 2)
+        {
+            for (size_t i = 0; i < numTasks; ++i)
+                fn (i);
+
+            return;
+        }
+
+        // Task ranges are packed into a single 64 bit value per thread
+        VCTR_ASSERT (numTasks <= std::numeric_limits<uint32_t>::max());
+
+        {
+            std::lock_guard lock (mutex);
+            task = [] (const void* f, size_t i) { (*static_cast<const Fn*> (f)) (i); };
+            taskFunction = &fn;
+
+            const auto numThreads = taskRanges.size();
+
+            for (size_t t = 0; t < numThreads; ++t)
+                taskRanges[t].range.store (packRange (numTasks * t / numThreads, numTasks * (t + 1) / numThreads), std::memory_order_relaxed);
+
+            numBusyWorkers = workers.size();
+            ++generation;
+        }
+
+        workAvailable.notify_all();
+        runTasks (0);
+
+        std::unique_lock lock (mutex);
+        workFinished.wait (lock, [this] { return numBusyWorkers == 0; });
+    }
+
+private:
+    //==============================================================================
+    /** The range of task indices [begin, end) that is still to be run by a thread, packed as (begin << 32) | end. */
+    struct alignas (64) TaskRange
+    {
+        std::atomic<uint64_t> range = 0;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<TaskRange> taskRanges;
+
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workFinished;
+
+    void (*task) (const void*, size_t) = nullptr;
+    const void* taskFunction = nullptr;
+
+    size_t numBusyWorkers = 0;
+    uint64_t generation = 0;
+    bool shouldExit = false;
+
+    static constexpr uint64_t packRange (size_t begin, size_t end) { return (uint64_t (begin) << 32) | uint64_t (end); }
+    static constexpr size_t rangeBegin (uint64_t range) { return size_t (range >> 32); }
+    static constexpr size_t rangeEnd (uint64_t range) { return size_t (range & 0xffffffff); }
+
+    void runTasks (size_t threadIndex)
+    {
+        auto& own = taskRanges[threadIndex].range;
+
+        while (true)
+        {
+            // Take the next task from the front of the own range
+            for (auto r = own.load (std::memory_order_relaxed); rangeBegin (r) < rangeEnd (r);)
+            {
+                if (own.compare_exchange_weak (r, packRange (rangeBegin (r) + 1, rangeEnd (r)), std::memory_order_relaxed))
+                {
+                    task (taskFunction, rangeBegin (r));
+                    r = own.load (std::memory_order_relaxed);
+                }
+            }
+
+            if (! steal (threadIndex))
+                return;
+        }
+    }
+
+    /** Moves the upper half of the remaining range of another thread to the own range and returns false if there was
+        nothing left to steal. Only the owner adds tasks to a range, so a thread that is done with its own range never
+        gets new tasks assigned by others.
+     */
+    bool steal (size_t threadIndex)
+    {
+        const auto numThreads = taskRanges.size();
+
+        for (size_t offset = 1; offset < numThreads; ++offset)
+        {
+            auto& victim = taskRanges[(threadIndex + offset) % numThreads].range;
+
+            for (auto r = victim.load (std::memory_order_relaxed); rangeBegin (r) < rangeEnd (r);)
+            {
+                const auto begin = rangeBegin (r);
+                const auto end = rangeEnd (r);
+                const auto mid = begin + (end - begin) / 2;
+
+                if (victim.compare_exchange_weak (r, packRange (begin, mid), std::memory_order_relaxed))
+                {
+                    taskRanges[threadIndex].range.store (packRange (mid, end), std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void workerLoop (size_t threadIndex)
+    {
+        uint64_t lastGeneration = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock lock (mutex);
+                workAvailable.wait (lock, [&] { return shouldExit || generation != lastGeneration; });
+
+                if (shouldExit)
+                    return;
+
+                lastGeneration = generation;
+            }
+
+            runTasks (threadIndex);
+
+            std::lock_guard lock (mutex);
+
+            // Every worker takes part in every parallelFor call, so that none of them can still read the task of a
+            // previous call when the next one starts
+            if (--numBusyWorkers == 0)
+                workFinished.notify_one();
+        }
+    }
+};
+
+} // namespace vctr
@@ -85,11 +85,15 @@ public:
     static void intToFloat (const uint32_t* src, float* dst, size_t len) { vDSP_vfltu32 (src, 1, dst, 1, len); }
 
     static float max        (const float* src, size_t len) { float r; vDSP_maxv (src, 1, &r, len); return r; }
+    static float maxAbs     (const float* src, size_t len) { float r; vDSP_maxmgv (src, 1, &r, len); return r; }
     static float min        (const float* src, size_t len) { float r; vDSP_minv (src, 1, &r, len); return r; }
     static float sum        (const float* src, size_t len) { float r; vDSP_sve (src, 1, &r, len); return r; }
     static float mean       (const float* src, size_t len) { float r; vDSP_meanv (src, 1, &r, len); return r; }
     static float meanSquare (const float* src, size_t len) { float r; vDSP_measqv (src, 1, &r, len); return r; }
     static float rms        (const float* src, size_t len) { float r; vDSP_rmsqv (src, 1, &r, len); return r; }
+    static float l1Norm     (const float* src, size_t len) { float r; vDSP_svemg (src, 1, &r, len); return r; }
+
+    static float dotProduct (const float* srcA, const float* srcB, size_t len) { float r; vDSP_dotpr (srcA, 1, srcB, 1, &r, len); return r; }
     // clang-format on
 };
 
@@ -158,11 +162,15 @@ public:
     }
 
     static double max        (const double* src, size_t len) { double r; vDSP_maxvD (src, 1, &r, len); return r; }
+    static double maxAbs     (const double* src, size_t len) { double r; vDSP_maxmgvD (src, 1, &r, len); return r; }
     static double min        (const double* src, size_t len) { double r; vDSP_minvD (src, 1, &r, len); return r; }
     static double sum        (const double* src, size_t len) { double r; vDSP_sveD (src, 1, &r, len); return r; }
     static double mean       (const double* src, size_t len) { double r; vDSP_meanvD (src, 1, &r, len); return r; }
     static double meanSquare (const double* src, size_t len) { double r; vDSP_measqvD (src, 1, &r, len); return r; }
     static double rms        (const double* src, size_t len) { double r; vDSP_rmsqvD (src, 1, &r, len); return r; }
+    static double l1Norm     (const double* src, size_t len) { double r; vDSP_svemgD (src, 1, &r, len); return r; }
+
+    static double dotProduct (const double* srcA, const double* srcB, size_t len) { double r; vDSP_dotprD (srcA, 1, srcB, 1, &r, len); return r; }
 };
 
 template <>
@@ -246,6 +254,28 @@ public:
         vDSP_zvmags (&s, 2, dst, 1, len);
     }
 
+    static std::complex<float> dotProduct (const std::complex<float>* srcA, const std::complex<float>* srcB, size_t len)
+    {
+        std::complex<float> r;
+        auto sa = sp (srcA);
+        auto sb = sp (srcB);
+        auto d = sp (r);
+        vDSP_zdotpr (&sa, 2, &sb, 2, &d, len);
+        return r;
+    }
+
+    static std::complex<float> innerProduct (const std::complex<float>* srcA, const std::complex<float>* srcB, size_t len)
+    {
+        std::complex<float> r;
+        auto sa = sp (srcA);
+        auto sb = sp (srcB);
+        auto d = sp (r);
+
+        // vDSP_zidotpr conjugates the elements of its first source
+        vDSP_zidotpr (&sb, 2, &sa, 2, &d, len);
+        return r;
+    }
+
     //==============================================================================
     // BLAS functions
     //==============================================================================
@@ -335,6 +365,28 @@ public:
         vDSP_zvmagsD (&s, 2, dst, 1, len);
     }
 
+    static std::complex<double> dotProduct (const std::complex<double>* srcA, const std::complex<double>* srcB, size_t len)
+    {
+        std::complex<double> r;
+        auto sa = sp (srcA);
+        auto sb = sp (srcB);
+        auto d = sp (r);
+        vDSP_zdotprD (&sa, 2, &sb, 2, &d, len);
+        return r;
+    }
+
+    static std::complex<double> innerProduct (const std::complex<double>* srcA, const std::complex<double>* srcB, size_t len)
+    {
+        std::complex<double> r;
+        auto sa = sp (srcA);
+        auto sb = sp (srcB);
+        auto d = sp (r);
+
+        // vDSP_zidotprD conjugates the elements of its first source
+        vDSP_zidotprD (&sb, 2, &sa, 2, &d, len);
+        return r;
+    }
+
     //==============================================================================
     // BLAS functions
     //==============================================================================
@@ -93,7 +93,10 @@ public:
     static float minAbs (const float* src, int len) { float r; assertIppNoErr (ippsMinAbs_32f (src, len, &r)); return r; }
     static float sum    (const float* src, int len) { float r; assertIppNoErr (ippsSum_32f (src, len, &r, ippAlgHintNone)); return r; }
     static float mean   (const float* src, int len) { float r; assertIppNoErr (ippsMean_32f (src, len, &r, ippAlgHintNone)); return r;}
+    static float l1Norm (const float* src, int len) { float r; assertIppNoErr (ippsNorm_L1_32f (src, len, &r)); return r; }
     static float l2Norm (const float* src, int len) { float r; assertIppNoErr (ippsNorm_L2_32f (src, len, &r)); return r; }
+
+    static float dotProduct (const float* srcA, const float* srcB, int len) { float r; assertIppNoErr (ippsDotProd_32f (srcA, srcB, len, &r)); return r; }
 };
 
 template <>
@@ -144,7 +147,10 @@ public:
     static double minAbs (const double* src, int len) { double r; assertIppNoErr (ippsMinAbs_64f (src, len, &r)); return r; }
     static double sum    (const double* src, int len) { double r; assertIppNoErr (ippsSum_64f (src, len, &r)); return r; }
     static double mean   (const double* src, int len) { double r; assertIppNoErr (ippsMean_64f (src, len, &r)); return r;}
+    static double l1Norm (const double* src, int len) { double r; assertIppNoErr (ippsNorm_L1_64f (src, len, &r)); return r; }
     static double l2Norm (const double* src, int len) { double r; assertIppNoErr (ippsNorm_L2_64f (src, len, &r)); return r;}
+
+    static double dotProduct (const double* srcA, const double* srcB, int len) { double r; assertIppNoErr (ippsDotProd_64f (srcA, srcB, len, &r)); return r; }
 };
 
 template <>
@@ -190,6 +196,7 @@ public:
     static void atanh (const std::complex<float>* src, std::complex<float>* dst, int len) { assertIppNoErr (ippsAtanh_32fc_A24 (fc(src), fc(dst), len)); }
 
     static std::complex<float> sum  (const std::complex<float>* src, int len) { std::complex<float> r; assertIppNoErr (ippsSum_32fc (fc (src), len, fc (&r), ippAlgHintNone)); return r; }
+    static std::complex<float> dotProduct (const std::complex<float>* srcA, const std::complex<float>* srcB, int len) { std::complex<float> r; assertIppNoErr (ippsDotProd_32fc (fc (srcA), fc (srcB), len, fc (&r))); return r; }
     static std::complex<float> mean (const std::complex<float>* src, int len) { std::complex<float> r; assertIppNoErr (ippsMean_32fc (fc (src), len, fc (&r), ippAlgHintNone)); return r;}
 };
 
@@ -236,6 +243,7 @@ public:
     static void atanh (const std::complex<double>* src, std::complex<double>* dst, int len) { assertIppNoErr (ippsAtanh_64fc_A53 (fc (src), fc(dst), len)); }
 
     static std::complex<double> sum  (const std::complex<double>* src, int len) { std::complex<double> r; assertIppNoErr (ippsSum_64fc (fc (src), len, fc (&r))); return r; }
+    static std::complex<double> dotProduct (const std::complex<double>* srcA, const std::complex<double>* srcB, int len) { std::complex<double> r; assertIppNoErr (ippsDotProd_64fc (fc (srcA), fc (srcB), len, fc (&r))); return r; }
     static std::complex<double> mean (const std::complex<double>* src, int len) { std::complex<double> r; assertIppNoErr (ippsMean_64fc (fc (src), len, fc (&r))); return r;}
 };
 
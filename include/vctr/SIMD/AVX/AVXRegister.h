@@ -47,15 +47,76 @@ struct AVXRegister<float>
     VCTR_TARGET ("avx") static AVXRegister broadcast     (float x)                                    { return { _mm256_broadcast_ss (&x) }; }
     VCTR_TARGET ("avx") static AVXRegister fromSSE       (SSERegister<float> a, SSERegister<float> b) { return { _mm256_set_m128 (a.value, b.value) }; }
 
+    // Loads the elements whose mask element has the sign bit set and takes all others from fill. Memory of unselected
+    // elements is not accessed.
+    VCTR_TARGET ("avx") static AVXRegister loadUnalignedMasked (const float* d, __m256i mask, AVXRegister fill) { return { _mm256_blendv_ps (fill.value, _mm256_maskload_ps (d, mask), _mm256_castsi256_ps (mask)) }; }
+
     //==============================================================================
     // Storing
     VCTR_TARGET ("avx") void storeUnaligned (float* d) const { _mm256_storeu_ps (d, value); }
     VCTR_TARGET ("avx") void storeAligned   (float* d) const { _mm256_store_ps  (d, value); }
 
+    // Stores the elements whose mask element has the sign bit set. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx") void storeUnalignedMasked (float* d, __m256i mask) const { _mm256_maskstore_ps (d, mask, value); }
+
+    //==============================================================================
+    // Half Precision Conversion, values are rounded to the nearest even value when storing. The float16 conversion
+    // requires the F16C extension, which is not available on all CPUs supporting AVX.
+    VCTR_TARGET ("avx,f16c") static AVXRegister loadFloat16  (const float16* d)  { return { _mm256_cvtph_ps (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (d))) }; }
+    VCTR_TARGET ("avx2")     static AVXRegister loadBFloat16 (const bfloat16* d) { return { _mm256_castsi256_ps (_mm256_slli_epi32 (_mm256_cvtepu16_epi32 (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (d))), 16)) }; }
+
+    VCTR_TARGET ("avx,f16c") void storeFloat16 (float16* d) const { _mm_storeu_si128 (reinterpret_cast<__m128i*> (d), _mm256_cvtps_ph (value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+    VCTR_TARGET ("avx2") void storeBFloat16 (bfloat16* d) const
+    {
+        const auto bits = _mm256_castps_si256 (value);
+        const auto lsb = _mm256_and_si256 (_mm256_srli_epi32 (bits, 16), _mm256_set1_epi32 (1));
+        auto rounded = _mm256_add_epi32 (bits, _mm256_add_epi32 (lsb, _mm256_set1_epi32 (0x7fff)));
+
+        // NaNs are truncated and made quiet, so that rounding can't turn them into infinity
+        rounded = _mm256_blendv_epi8 (rounded, _mm256_or_si256 (bits, _mm256_set1_epi32 (0x400000)), _mm256_castps_si256 (_mm256_cmp_ps (value, value, _CMP_UNORD_Q)));
+
+        // Packing works within the 128 bit lanes, so the lower 64 bits of both lanes are moved together afterwards
+        const auto packed = _mm256_packus_epi32 (_mm256_srli_epi32 (rounded, 16), _mm256_setzero_si256());
+        _mm_storeu_si128 (reinterpret_cast<__m128i*> (d), _mm256_castsi256_si128 (_mm256_permute4x64_epi64 (packed, 0xD8)));
+    }
+
     //==============================================================================
     // Bit Operations
     VCTR_TARGET ("avx") static AVXRegister andNot (AVXRegister a, AVXRegister b) { return { _mm256_andnot_ps (a.value, b.value) }; }
 
+    //==============================================================================
+    // Comparison and Selection, lanes compared against NaN are always false. GCC folds a blendv of a comparison result
+    // into a generic vector select, which it only lowers to a blend instruction with AVX2, so the lanes are selected by
+    // bit operations.
+    VCTR_TARGET ("avx") static AVXRegister greaterThan (AVXRegister a, AVXRegister b)                    { return { _mm256_cmp_ps (a.value, b.value, _CMP_GT_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister lessThan    (AVXRegister a, AVXRegister b)                    { return { _mm256_cmp_ps (a.value, b.value, _CMP_LT_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister select      (AVXRegister mask, AVXRegister a, AVXRegister b) { return { _mm256_or_ps (_mm256_and_ps (mask.value, a.value), _mm256_andnot_ps (mask.value, b.value)) }; }
+
+    // Returns one bit per element, set if the element of a comparison result is true
+    VCTR_TARGET ("avx") static uint32_t toBitMask (AVXRegister mask) { return uint32_t (_mm256_movemask_ps (mask.value)); }
+
+    //==============================================================================
+    // Element Shifting, used by prefix scans. AVX has no shuffles across the two 128 bit lanes, so elements are shifted
+    // up within each lane, or whole lanes are shifted up. The lowest elements are filled from fill, which is expected to
+    // hold the same value in all elements.
+    template <int n> requires (n == 1 || n == 2)
+    VCTR_TARGET ("avx") static AVXRegister shiftUpWithinLanes       (AVXRegister x, AVXRegister fill) { return { _mm256_blend_ps (_mm256_permute_ps (x.value, n == 1 ? 0x90 : 0x40), fill.value, n == 1 ? 0x11 : 0x33) }; }
+    VCTR_TARGET ("avx") static AVXRegister shiftLanesUp             (AVXRegister x, AVXRegister fill) { return { _mm256_permute2f128_ps (x.value, fill.value, 0x02) }; }
+    VCTR_TARGET ("avx") static AVXRegister broadcastLastWithinLanes (AVXRegister x)                   { return { _mm256_permute_ps (x.value, 0xFF) }; }
+    VCTR_TARGET ("avx") static AVXRegister broadcastLast            (AVXRegister x)                   { return { _mm256_permute_ps (_mm256_permute2f128_ps (x.value, x.value, 0x11), 0xFF) }; }
+
+    //==============================================================================
+    // Element Permutation, used by sorting networks. swapAdjacentGroups exchanges each group of n adjacent elements
+    // with its neighbouring group, so that element i ends up at index i ^ n. blend takes the elements whose bit is set in
+    // mask from b and all others from a. permute moves the element at index indices[i] to index i.
+    template <int n>
+    VCTR_TARGET ("avx")  static AVXRegister swapAdjacentGroups (AVXRegister x)                          { return { n == 1 ? _mm256_permute_ps (x.value, 0xB1) : n == 2 ? _mm256_permute_ps (x.value, 0x4E) : _mm256_permute2f128_ps (x.value, x.value, 0x01) }; }
+    VCTR_TARGET ("avx")  static AVXRegister reverse            (AVXRegister x)                          { return { _mm256_permute_ps (_mm256_permute2f128_ps (x.value, x.value, 0x01), 0x1B) }; }
+    template <int mask>
+    VCTR_TARGET ("avx")  static AVXRegister blend              (AVXRegister a, AVXRegister b)           { return { _mm256_blend_ps (a.value, b.value, mask) }; }
+    VCTR_TARGET ("avx2") static AVXRegister permute            (AVXRegister x, const int32_t* indices) { return { _mm256_permutevar8x32_ps (x.value, _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (indices))) }; }
+
     //==============================================================================
     // Math
     VCTR_TARGET ("avx") static AVXRegister mul (AVXRegister a, AVXRegister b) { return { _mm256_mul_ps (a.value, b.value) }; }
@@ -64,7 +125,352 @@ struct AVXRegister<float>
     VCTR_TARGET ("avx") static AVXRegister div (AVXRegister a, AVXRegister b) { return { _mm256_div_ps (a.value, b.value) }; }
     VCTR_TARGET ("avx") static AVXRegister max (AVXRegister a, AVXRegister b) { return { _mm256_max_ps (a.value, b.value) }; }
     VCTR_TARGET ("avx") static AVXRegister min (AVXRegister a, AVXRegister b) { return { _mm256_min_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister sqrt (AVXRegister x)              { return { _mm256_sqrt_ps (x.value) }; }
+
+    //==============================================================================
+    // Fused Multiply Add, only usable in code compiled with FMA support, see Config::hasFMA
+    VCTR_TARGET ("fma") static AVXRegister fma  (AVXRegister a, AVXRegister b, AVXRegister c) { return { _mm256_fmadd_ps (a.value, b.value, c.value) }; }
+    VCTR_TARGET ("fma") static AVXRegister fms  (AVXRegister a, AVXRegister b, AVXRegister c) { return { _mm256_fmsub_ps (a.value, b.value, c.value) }; }
+    VCTR_TARGET ("fma") static AVXRegister fnma (AVXRegister a, AVXRegister b, AVXRegister c) { return { _mm256_fnmadd_ps (a.value, b.value, c.value) }; }
     // clang-format on
+
+    //==============================================================================
+    // Fast Approximations
+    // The rsqrt and rcp estimates refined by one Newton-Raphson step. Measured against a double reference, the max.
+    // error is 5 ulp for fastSqrt and fastRsqrt and 4 ulp for fastReciprocal. Zero, inf and NaN arguments give the
+    // same results as the exact computation. Subnormal arguments and results are flushed to zero, as the estimate
+    // instructions do.
+    VCTR_TARGET ("avx") static AVXRegister fastSqrt (AVXRegister x)       { return { computeFastSqrt (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister fastRsqrt (AVXRegister x)      { return { computeFastRsqrt (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister fastReciprocal (AVXRegister x) { return { computeFastReciprocal (x.value) }; }
+
+    //==============================================================================
+    // Exponential and Logarithmic Functions
+    // Polynomial approximations based on the Cephes math library. Measured against a long double reference for all
+    // float arguments, the max. error is 1.0 ulp for exp, 0.9 ulp for ln, 1.5 ulp for log2 and 2.0 ulp for log10.
+    // Subnormal arguments and results are handled correctly, special values follow std::exp and std::log.
+    VCTR_TARGET ("avx") static AVXRegister exp (AVXRegister x) { return { computeExp (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister ln (AVXRegister x) { return { computeLn (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister log2 (AVXRegister x) { return { computeLog2 (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister log10 (AVXRegister x) { return { computeLog10 (x.value) }; }
+
+    /** Raises base to the power of exponent. The lanes are computed as exp (exponent * ln (|base|)) in double precision,
+        which keeps the max. error at 1 ulp. Special values follow std::pow.
+     */
+    VCTR_TARGET ("avx") static AVXRegister pow (AVXRegister base, AVXRegister exponent) { return { computePow (base.value, exponent.value) }; }
+
+    //==============================================================================
+    // Trigonometric Functions
+    // Polynomial approximations based on the Cephes math library after a reduction of the argument to
+    // [-pi / 4, pi / 4]. Measured against a long double reference, the max. error is 3 ulp for sin and cos
+    // and 4 ulp for tan. Lanes with arguments above 8192, where the reduction gets inaccurate, and inf are
+    // computed with the std functions.
+    VCTR_TARGET ("avx") static AVXRegister sin (AVXRegister x)
+    {
+        return { computeLargeArgumentsWithStd (x.value, computeSinCos (x.value).sin, [] (float v) { return std::sin (v); }) };
+    }
+
+    VCTR_TARGET ("avx") static AVXRegister cos (AVXRegister x)
+    {
+        return { computeLargeArgumentsWithStd (x.value, computeSinCos (x.value).cos, [] (float v) { return std::cos (v); }) };
+    }
+
+    /** Returns the sine and the cosine of x, sharing the argument reduction between both. */
+    VCTR_TARGET ("avx") static std::pair<AVXRegister, AVXRegister> sinCos (AVXRegister x)
+    {
+        const auto [s, c] = computeSinCos (x.value);
+
+        return { { computeLargeArgumentsWithStd (x.value, s, [] (float v) { return std::sin (v); }) },
+                 { computeLargeArgumentsWithStd (x.value, c, [] (float v) { return std::cos (v); }) } };
+    }
+
+    VCTR_TARGET ("avx") static AVXRegister tan (AVXRegister x) { return { computeTan (x.value) }; }
+
+private:
+    // The public functions above only wrap these kernels, which work on the native type. GCC clears the upper lanes of an
+    // AVXRegister returned by a function that is not inlined, unless the whole translation unit is compiled with AVX
+    // enabled. One line wrappers are always inlined, a native __m256 return value is not affected.
+    VCTR_TARGET ("avx") static __m256 computeFastSqrt (__m256 x)
+    {
+        const auto isNormal = isNormalNumber (x);
+        const auto y = _mm256_mul_ps (x, refineRsqrt (x, _mm256_rsqrt_ps (x)));
+
+        // Clearing the mantissa bits flushes subnormal arguments to zero and keeps zero and inf. The mask of negative and
+        // NaN arguments turns them into NaN
+        const auto special = _mm256_and_ps (x, _mm256_castsi256_ps (_mm256_set1_epi32 (int32_t (0xff800000))));
+        const auto result = _mm256_or_ps (_mm256_and_ps (isNormal, y), _mm256_andnot_ps (isNormal, special));
+        return _mm256_or_ps (result, _mm256_cmp_ps (x, _mm256_setzero_ps(), _CMP_NGE_UQ));
+    }
+
+    VCTR_TARGET ("avx") static __m256 computeFastRsqrt (__m256 x)
+    {
+        const auto isNormal = isNormalNumber (x);
+        const auto estimate = _mm256_rsqrt_ps (x);
+        return _mm256_or_ps (_mm256_and_ps (isNormal, refineRsqrt (x, estimate)), _mm256_andnot_ps (isNormal, estimate));
+    }
+
+    VCTR_TARGET ("avx") static __m256 computeFastReciprocal (__m256 x)
+    {
+        const auto isNormal = isNormalNumber (x);
+        const auto estimate = _mm256_rcp_ps (x);
+
+        // y * (2 - x * y)
+        const auto y = _mm256_mul_ps (estimate, _mm256_sub_ps (_mm256_set1_ps (2.0f), _mm256_mul_ps (x, estimate)));
+        return _mm256_or_ps (_mm256_and_ps (isNormal, y), _mm256_andnot_ps (isNormal, estimate));
+    }
+
+    VCTR_TARGET ("avx") static __m256 computeExp (__m256 x)
+    {
+        // Beyond this range the result is inf or 0 anyway, clamping keeps the exponent computation below valid
+        const auto v = _mm256_min_ps (_mm256_set1_ps (89.0f), _mm256_max_ps (_mm256_set1_ps (-104.0f), x));
+
+        // exp (v) = 2^n * exp (r) with r = v - n * ln (2), ln (2) being split into an exact high and a low part
+        const auto n = _mm256_round_ps (_mm256_mul_ps (v, _mm256_set1_ps (1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        auto r = _mm256_sub_ps (v, _mm256_mul_ps (n, _mm256_set1_ps (0.693359375f)));
+        r = _mm256_sub_ps (r, _mm256_mul_ps (n, _mm256_set1_ps (-2.12194440e-4f)));
+
+        auto p = _mm256_set1_ps (1.9875691500e-4f);
+        p = _mm256_add_ps (_mm256_mul_ps (p, r), _mm256_set1_ps (1.3981999507e-3f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, r), _mm256_set1_ps (8.3334519073e-3f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, r), _mm256_set1_ps (4.1665795894e-2f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, r), _mm256_set1_ps (1.6666665459e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, r), _mm256_set1_ps (5.0000001201e-1f));
+        p = _mm256_add_ps (_mm256_add_ps (_mm256_mul_ps (p, _mm256_mul_ps (r, r)), r), _mm256_set1_ps (1.0f));
+
+        // Scaling in two steps lets the result overflow to inf or underflow into the subnormal range
+        const auto n1 = _mm256_floor_ps (_mm256_mul_ps (n, _mm256_set1_ps (0.5f)));
+        return _mm256_mul_ps (_mm256_mul_ps (p, pow2 (n1)), pow2 (_mm256_sub_ps (n, n1)));
+    }
+
+    VCTR_TARGET ("avx") static __m256 computeLn (__m256 x)
+    {
+        const auto [f, t, e] = decomposeLog (x);
+
+        // ln (x) = e * ln (2) + f + t, ln (2) being split into an exact high and a low part
+        auto y = _mm256_add_ps (t, _mm256_mul_ps (e, _mm256_set1_ps (-2.12194440e-4f)));
+        y = _mm256_add_ps (y, f);
+        y = _mm256_add_ps (y, _mm256_mul_ps (e, _mm256_set1_ps (0.693359375f)));
+
+        return handleLogSpecialValues (x, y);
+    }
+
+    VCTR_TARGET ("avx") static __m256 computeLog2 (__m256 x)
+    {
+        const auto [f, t, e] = decomposeLog (x);
+
+        // log2 (x) = e + (f + t) * log2 (e), log2 (e) being split into 1 and a low part
+        auto y = _mm256_mul_ps (t, _mm256_set1_ps (0.44269504088896340736f));
+        y = _mm256_add_ps (y, _mm256_mul_ps (f, _mm256_set1_ps (0.44269504088896340736f)));
+        y = _mm256_add_ps (y, t);
+        y = _mm256_add_ps (y, f);
+        y = _mm256_add_ps (y, e);
+
+        return handleLogSpecialValues (x, y);
+    }
+
+    VCTR_TARGET ("avx") static __m256 computeLog10 (__m256 x)
+    {
+        const auto [f, t, e] = decomposeLog (x);
+
+        // log10 (x) = e * log10 (2) + (f + t) * log10 (e), both constants being split into an exact high and a low part
+        auto y = _mm256_mul_ps (_mm256_add_ps (f, t), _mm256_set1_ps (7.00731903251827651129e-4f));
+        y = _mm256_add_ps (y, _mm256_mul_ps (t, _mm256_set1_ps (4.3359375e-1f)));
+        y = _mm256_add_ps (y, _mm256_mul_ps (f, _mm256_set1_ps (4.3359375e-1f)));
+        y = _mm256_add_ps (y, _mm256_mul_ps (e, _mm256_set1_ps (2.48745663981195213739e-4f)));
+        y = _mm256_add_ps (y, _mm256_mul_ps (e, _mm256_set1_ps (3.0078125e-1f)));
+
+        return handleLogSpecialValues (x, y);
+    }
+
+    VCTR_TARGET ("avx") static __m256 computePow (__m256 base, __m256 exponent);
+
+    VCTR_TARGET ("avx") static __m256 computeTan (__m256 x)
+    {
+        const auto [n, r] = reduceToQuadrant (x);
+
+        const auto z = _mm256_mul_ps (r, r);
+        auto p = _mm256_set1_ps (9.38540185543e-3f);
+        p = _mm256_add_ps (_mm256_mul_ps (p, z), _mm256_set1_ps (3.11992232697e-3f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, z), _mm256_set1_ps (2.44301354525e-2f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, z), _mm256_set1_ps (5.34112807005e-2f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, z), _mm256_set1_ps (1.33387994085e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, z), _mm256_set1_ps (3.33331568548e-1f));
+        const auto t = _mm256_add_ps (_mm256_mul_ps (_mm256_mul_ps (p, z), r), r);
+
+        // tan (x) = -1 / tan (r) in odd quadrants
+        const auto isOddQuadrant = _mm256_cmp_ps (n, _mm256_mul_ps (_mm256_floor_ps (_mm256_mul_ps (n, _mm256_set1_ps (0.5f))), _mm256_set1_ps (2.0f)), _CMP_NEQ_UQ);
+        const auto y = _mm256_or_ps (_mm256_andnot_ps (isOddQuadrant, t), _mm256_and_ps (isOddQuadrant, _mm256_div_ps (_mm256_set1_ps (-1.0f), t)));
+
+        return computeLargeArgumentsWithStd (x, y, [] (float v) { return std::tan (v); });
+    }
+
+    /** Returns a mask of all lanes holding a finite value with a magnitude not below the smallest normal float. */
+    VCTR_TARGET ("avx") static __m256 isNormalNumber (__m256 x)
+    {
+        const auto magnitude = _mm256_andnot_ps (_mm256_set1_ps (-0.0f), x);
+        return _mm256_and_ps (_mm256_cmp_ps (magnitude, _mm256_set1_ps (std::numeric_limits<float>::min()), _CMP_GE_OQ), _mm256_cmp_ps (magnitude, _mm256_set1_ps (std::numeric_limits<float>::max()), _CMP_LE_OQ));
+    }
+
+    /** Refines the estimate y of 1 / sqrt (x) by one Newton-Raphson step, y * (1.5 - 0.5 * x * y^2). */
+    VCTR_TARGET ("avx") static __m256 refineRsqrt (__m256 x, __m256 y)
+    {
+        const auto halfXTimesYSquared = _mm256_mul_ps (_mm256_mul_ps (_mm256_mul_ps (x, _mm256_set1_ps (0.5f)), y), y);
+        return _mm256_mul_ps (y, _mm256_sub_ps (_mm256_set1_ps (1.5f), halfXTimesYSquared));
+    }
+
+    struct LogDecomposition
+    {
+        __m256 f, t, e;
+    };
+
+    /** Returns 2^n for integer values n in the normal exponent range by writing n + 127 into the exponent bits. */
+    VCTR_TARGET ("avx") static __m256 pow2 (__m256 n)
+    {
+        return _mm256_castsi256_ps (_mm256_cvttps_epi32 (_mm256_mul_ps (_mm256_add_ps (n, _mm256_set1_ps (127.0f)), _mm256_set1_ps (8388608.0f))));
+    }
+
+    /** Splits x into 2^e * (1 + f) with 1 + f in [sqrt (0.5), sqrt (2)) and computes t = ln (1 + f) - f. */
+    VCTR_TARGET ("avx") static LogDecomposition decomposeLog (__m256 x)
+    {
+        // Subnormal values are scaled by 2^25 into the normal range first
+        const auto isSubnormal = _mm256_cmp_ps (x, _mm256_set1_ps (std::numeric_limits<float>::min()), _CMP_LT_OQ);
+        x = _mm256_or_ps (_mm256_and_ps (isSubnormal, _mm256_mul_ps (x, _mm256_set1_ps (33554432.0f))), _mm256_andnot_ps (isSubnormal, x));
+
+        // x = 2^e * m with m in [0.5, 1). The biased exponent bits are converted to float as an integer, which is exact
+        const auto exponentMask = _mm256_castsi256_ps (_mm256_set1_epi32 (0x7f800000));
+        const auto m = _mm256_or_ps (_mm256_andnot_ps (exponentMask, x), _mm256_set1_ps (0.5f));
+        auto e = _mm256_mul_ps (_mm256_cvtepi32_ps (_mm256_castps_si256 (_mm256_and_ps (x, exponentMask))), _mm256_set1_ps (1.1920928955078125e-7f));
+        e = _mm256_sub_ps (e, _mm256_add_ps (_mm256_set1_ps (126.0f), _mm256_and_ps (isSubnormal, _mm256_set1_ps (25.0f))));
+
+        // Mantissas below sqrt (0.5) are doubled, so that f = m - 1 is centered around zero
+        const auto isBelowSqrtHalf = _mm256_cmp_ps (m, _mm256_set1_ps (0.707106781186547524f), _CMP_LT_OQ);
+        e = _mm256_sub_ps (e, _mm256_and_ps (isBelowSqrtHalf, _mm256_set1_ps (1.0f)));
+        const auto f = _mm256_add_ps (_mm256_sub_ps (m, _mm256_set1_ps (1.0f)), _mm256_and_ps (isBelowSqrtHalf, m));
+
+        const auto z = _mm256_mul_ps (f, f);
+        auto p = _mm256_set1_ps (7.0376836292e-2f);
+        p = _mm256_add_ps (_mm256_mul_ps (p, f), _mm256_set1_ps (-1.1514610310e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, f), _mm256_set1_ps (1.1676998740e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, f), _mm256_set1_ps (-1.2420140846e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, f), _mm256_set1_ps (1.4249322787e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, f), _mm256_set1_ps (-1.6668057665e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, f), _mm256_set1_ps (2.0000714765e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, f), _mm256_set1_ps (-2.4999993993e-1f));
+        p = _mm256_add_ps (_mm256_mul_ps (p, f), _mm256_set1_ps (3.3333331174e-1f));
+        const auto t = _mm256_sub_ps (_mm256_mul_ps (_mm256_mul_ps (p, f), z), _mm256_mul_ps (z, _mm256_set1_ps (0.5f)));
+
+        return { f, t, e };
+    }
+
+    /** Returns -inf for zero, inf for inf and NaN for negative and NaN arguments, y otherwise. */
+    VCTR_TARGET ("avx") static __m256 handleLogSpecialValues (__m256 x, __m256 y)
+    {
+        const auto zero = _mm256_setzero_ps();
+        const auto inf = _mm256_set1_ps (std::numeric_limits<float>::infinity());
+
+        const auto isZero = _mm256_cmp_ps (x, zero, _CMP_EQ_OQ);
+        const auto isInf = _mm256_cmp_ps (x, inf, _CMP_EQ_OQ);
+
+        // A mask with all bits set is a NaN bit pattern, so or-ing it into y turns invalid lanes into NaN
+        y = _mm256_or_ps (_mm256_andnot_ps (isZero, y), _mm256_and_ps (isZero, _mm256_sub_ps (zero, inf)));
+        y = _mm256_or_ps (_mm256_andnot_ps (isInf, y), _mm256_and_ps (isInf, inf));
+        return _mm256_or_ps (y, _mm256_cmp_ps (x, zero, _CMP_NGE_UQ));
+    }
+
+    /** Takes y = |x|^e and applies the sign for negative x raised to odd integers, NaN for finite negative x raised to
+        non integers and 1 for pow (x, 0), pow (1, e) and pow (-1, +-inf), as std::pow does.
+     */
+    VCTR_TARGET ("avx") static __m256 handlePowSpecialValues (__m256 x, __m256 e, __m256 y)
+    {
+        const auto one = _mm256_set1_ps (1.0f);
+        const auto inf = _mm256_set1_ps (std::numeric_limits<float>::infinity());
+        const auto signBit = _mm256_set1_ps (-0.0f);
+
+        const auto eHalf = _mm256_mul_ps (e, _mm256_set1_ps (0.5f));
+        const auto isInteger = _mm256_cmp_ps (_mm256_floor_ps (e), e, _CMP_EQ_OQ);
+        const auto isOddInteger = _mm256_and_ps (isInteger, _mm256_cmp_ps (_mm256_floor_ps (eHalf), eHalf, _CMP_NEQ_UQ));
+        const auto isFiniteNegative = _mm256_and_ps (_mm256_cmp_ps (x, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_cmp_ps (x, _mm256_sub_ps (_mm256_setzero_ps(), inf), _CMP_GT_OQ));
+
+        y = _mm256_xor_ps (y, _mm256_and_ps (isOddInteger, _mm256_and_ps (x, signBit)));
+        y = _mm256_or_ps (y, _mm256_andnot_ps (isInteger, isFiniteNegative));
+
+        const auto isMinusOneToInf = _mm256_and_ps (_mm256_cmp_ps (x, _mm256_set1_ps (-1.0f), _CMP_EQ_OQ), _mm256_cmp_ps (_mm256_andnot_ps (signBit, e), inf, _CMP_EQ_OQ));
+        const auto isOne = _mm256_or_ps (_mm256_or_ps (_mm256_cmp_ps (e, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_cmp_ps (x, one, _CMP_EQ_OQ)), isMinusOneToInf);
+        return _mm256_or_ps (_mm256_andnot_ps (isOne, y), _mm256_and_ps (isOne, one));
+    }
+
+    struct QuadrantReduction
+    {
+        __m256 n, r;
+    };
+
+    struct SinCosResult
+    {
+        __m256 sin, cos;
+    };
+
+    /** Splits x into n * pi / 2 + r with r in [-pi / 4, pi / 4]. pi / 2 is split into four parts, the products of the first three are exact. */
+    VCTR_TARGET ("avx") static QuadrantReduction reduceToQuadrant (__m256 x)
+    {
+        const auto n = _mm256_round_ps (_mm256_mul_ps (x, _mm256_set1_ps (0.636619772367581343f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        auto r = _mm256_sub_ps (x, _mm256_mul_ps (n, _mm256_set1_ps (1.5703125f)));
+        r = _mm256_sub_ps (r, _mm256_mul_ps (n, _mm256_set1_ps (4.837512969970703125e-4f)));
+        r = _mm256_sub_ps (r, _mm256_mul_ps (n, _mm256_set1_ps (7.549533620476723e-8f)));
+        r = _mm256_sub_ps (r, _mm256_mul_ps (n, _mm256_set1_ps (2.5633440682570896e-12f)));
+
+        return { n, r };
+    }
+
+    VCTR_TARGET ("avx") static SinCosResult computeSinCos (__m256 x)
+    {
+        const auto [n, r] = reduceToQuadrant (x);
+        const auto z = _mm256_mul_ps (r, r);
+
+        auto s = _mm256_set1_ps (-1.9515295891e-4f);
+        s = _mm256_add_ps (_mm256_mul_ps (s, z), _mm256_set1_ps (8.3321608736e-3f));
+        s = _mm256_add_ps (_mm256_mul_ps (s, z), _mm256_set1_ps (-1.6666654611e-1f));
+        s = _mm256_add_ps (_mm256_mul_ps (_mm256_mul_ps (s, z), r), r);
+
+        auto c = _mm256_set1_ps (2.443315711809948e-5f);
+        c = _mm256_add_ps (_mm256_mul_ps (c, z), _mm256_set1_ps (-1.388731625493765e-3f));
+        c = _mm256_add_ps (_mm256_mul_ps (c, z), _mm256_set1_ps (4.166664568298827e-2f));
+        c = _mm256_add_ps (_mm256_sub_ps (_mm256_mul_ps (_mm256_mul_ps (c, z), z), _mm256_mul_ps (z, _mm256_set1_ps (0.5f))), _mm256_set1_ps (1.0f));
+
+        // In odd quadrants sin and cos swap roles. sin is negative in quadrants 2 and 3, cos in quadrants 1 and 2
+        const auto nHalf = _mm256_floor_ps (_mm256_mul_ps (n, _mm256_set1_ps (0.5f)));
+        const auto nQuarter = _mm256_floor_ps (_mm256_mul_ps (n, _mm256_set1_ps (0.25f)));
+        const auto isOddQuadrant = _mm256_cmp_ps (n, _mm256_add_ps (nHalf, nHalf), _CMP_NEQ_UQ);
+        const auto isSinNegative = _mm256_cmp_ps (nHalf, _mm256_add_ps (nQuarter, nQuarter), _CMP_NEQ_UQ);
+        const auto isCosNegative = _mm256_xor_ps (isOddQuadrant, isSinNegative);
+        const auto signBit = _mm256_set1_ps (-0.0f);
+
+        const auto sinResult = _mm256_or_ps (_mm256_andnot_ps (isOddQuadrant, s), _mm256_and_ps (isOddQuadrant, c));
+        const auto cosResult = _mm256_or_ps (_mm256_andnot_ps (isOddQuadrant, c), _mm256_and_ps (isOddQuadrant, s));
+
+        return { _mm256_xor_ps (sinResult, _mm256_and_ps (isSinNegative, signBit)), _mm256_xor_ps (cosResult, _mm256_and_ps (isCosNegative, signBit)) };
+    }
+
+    /** Replaces the lanes of y with the result of stdFn for all lanes where the absolute value of x is too large for reduceToQuadrant or inf. */
+    template <class StdFn>
+    VCTR_TARGET ("avx") static __m256 computeLargeArgumentsWithStd (__m256 x, __m256 y, StdFn&& stdFn)
+    {
+        const auto isLarge = _mm256_movemask_ps (_mm256_cmp_ps (_mm256_andnot_ps (_mm256_set1_ps (-0.0f), x), _mm256_set1_ps (8192.0f), _CMP_GT_OQ));
+
+        if (isLarge == 0)
+            return y;
+
+        alignas (32) float xs[numElements], ys[numElements];
+        _mm256_store_ps (xs, x);
+        _mm256_store_ps (ys, y);
+
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            if (isLarge & (1 << i))
+                ys[i] = stdFn (xs[i]);
+        }
+
+        return _mm256_load_ps (ys);
+    }
 };
 
 template <>
@@ -83,15 +489,55 @@ struct AVXRegister<double>
     VCTR_TARGET ("avx") static AVXRegister broadcast     (double x) { return                            { _mm256_broadcast_sd (&x) }; }
     VCTR_TARGET ("avx") static AVXRegister fromSSE       (SSERegister<double> a, SSERegister<double> b) { return { _mm256_set_m128d (a.value, b.value) }; }
 
+    // Loads the elements whose mask element has the sign bit set and takes all others from fill. Memory of unselected
+    // elements is not accessed.
+    VCTR_TARGET ("avx") static AVXRegister loadUnalignedMasked (const double* d, __m256i mask, AVXRegister fill) { return { _mm256_blendv_pd (fill.value, _mm256_maskload_pd (d, mask), _mm256_castsi256_pd (mask)) }; }
+
     //==============================================================================
     // Storing
     VCTR_TARGET ("avx") void storeUnaligned (double* d) const { _mm256_storeu_pd (d, value); }
     VCTR_TARGET ("avx") void storeAligned   (double* d) const { _mm256_store_pd (d, value); }
 
+    // Stores the elements whose mask element has the sign bit set. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx") void storeUnalignedMasked (double* d, __m256i mask) const { _mm256_maskstore_pd (d, mask, value); }
+
     //==============================================================================
     // Bit Operations
     VCTR_TARGET ("avx") static AVXRegister andNot (AVXRegister a, AVXRegister b) { return { _mm256_andnot_pd (a.value, b.value) }; }
 
+    //==============================================================================
+    // Comparison and Selection, lanes compared against NaN are always false. GCC folds a blendv of a comparison result
+    // into a generic vector select, which it only lowers to a blend instruction with AVX2, so the lanes are selected by
+    // bit operations.
+    VCTR_TARGET ("avx") static AVXRegister greaterThan (AVXRegister a, AVXRegister b)                    { return { _mm256_cmp_pd (a.value, b.value, _CMP_GT_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister lessThan    (AVXRegister a, AVXRegister b)                    { return { _mm256_cmp_pd (a.value, b.value, _CMP_LT_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister select      (AVXRegister mask, AVXRegister a, AVXRegister b) { return { _mm256_or_pd (_mm256_and_pd (mask.value, a.value), _mm256_andnot_pd (mask.value, b.value)) }; }
+
+    // Returns one bit per element, set if the element of a comparison result is true
+    VCTR_TARGET ("avx") static uint32_t toBitMask (AVXRegister mask) { return uint32_t (_mm256_movemask_pd (mask.value)); }
+
+    //==============================================================================
+    // Element Shifting, used by prefix scans. AVX has no shuffles across the two 128 bit lanes, so elements are shifted
+    // up within each lane, or whole lanes are shifted up. The lowest elements are filled from fill, which is expected to
+    // hold the same value in all elements.
+    template <int n> requires (n == 1)
+    VCTR_TARGET ("avx") static AVXRegister shiftUpWithinLanes       (AVXRegister x, AVXRegister fill) { return { _mm256_blend_pd (_mm256_permute_pd (x.value, 0x0), fill.value, 0x5) }; }
+    VCTR_TARGET ("avx") static AVXRegister shiftLanesUp             (AVXRegister x, AVXRegister fill) { return { _mm256_permute2f128_pd (x.value, fill.value, 0x02) }; }
+    VCTR_TARGET ("avx") static AVXRegister broadcastLastWithinLanes (AVXRegister x)                   { return { _mm256_permute_pd (x.value, 0xF) }; }
+    VCTR_TARGET ("avx") static AVXRegister broadcastLast            (AVXRegister x)                   { return { _mm256_permute_pd (_mm256_permute2f128_pd (x.value, x.value, 0x11), 0xF) }; }
+
+    //==============================================================================
+    // Element Permutation, used by sorting networks. swapAdjacentGroups exchanges each group of n adjacent elements
+    // with its neighbouring group, so that element i ends up at index i ^ n. blend takes the elements whose bit is set in
+    // mask from b and all others from a. permute moves the 32 bit half at index indices[i] to index i, so each element
+    // is addressed by two consecutive indices.
+    template <int n>
+    VCTR_TARGET ("avx")  static AVXRegister swapAdjacentGroups (AVXRegister x)                          { return { n == 1 ? _mm256_permute_pd (x.value, 0x5) : _mm256_permute2f128_pd (x.value, x.value, 0x01) }; }
+    VCTR_TARGET ("avx")  static AVXRegister reverse            (AVXRegister x)                          { return { _mm256_permute_pd (_mm256_permute2f128_pd (x.value, x.value, 0x01), 0x5) }; }
+    template <int mask>
+    VCTR_TARGET ("avx")  static AVXRegister blend              (AVXRegister a, AVXRegister b)           { return { _mm256_blend_pd (a.value, b.value, mask) }; }
+    VCTR_TARGET ("avx2") static AVXRegister permute            (AVXRegister x, const int32_t* indices) { return { _mm256_castps_pd (_mm256_permutevar8x32_ps (_mm256_castpd_ps (x.value), _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (indices)))) }; }
+
     //==============================================================================
     // Math
     VCTR_TARGET ("avx") static AVXRegister mul (AVXRegister a, AVXRegister b) { return { _mm256_mul_pd (a.value, b.value) }; }
@@ -100,9 +546,428 @@ struct AVXRegister<double>
     VCTR_TARGET ("avx") static AVXRegister div (AVXRegister a, AVXRegister b) { return { _mm256_div_pd (a.value, b.value) }; }
     VCTR_TARGET ("avx") static AVXRegister max (AVXRegister a, AVXRegister b) { return { _mm256_max_pd (a.value, b.value) }; }
     VCTR_TARGET ("avx") static AVXRegister min (AVXRegister a, AVXRegister b) { return { _mm256_min_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister sqrt (AVXRegister x)              { return { _mm256_sqrt_pd (x.value) }; }
+
+    //==============================================================================
+    // Fused Multiply Add, only usable in code compiled with FMA support, see Config::hasFMA
+    VCTR_TARGET ("fma") static AVXRegister fma  (AVXRegister a, AVXRegister b, AVXRegister c) { return { _mm256_fmadd_pd (a.value, b.value, c.value) }; }
+    VCTR_TARGET ("fma") static AVXRegister fms  (AVXRegister a, AVXRegister b, AVXRegister c) { return { _mm256_fmsub_pd (a.value, b.value, c.value) }; }
+    VCTR_TARGET ("fma") static AVXRegister fnma (AVXRegister a, AVXRegister b, AVXRegister c) { return { _mm256_fnmadd_pd (a.value, b.value, c.value) }; }
     // clang-format on
+
+    //==============================================================================
+    // Exponential and Logarithmic Functions
+    // Polynomial approximations based on the Cephes math library. Measured against a long double reference for random
+    // arguments over the entire double range, the max. error is 1.7 ulp for exp, 1.0 ulp for ln, 1.7 ulp for log2 and
+    // 2.0 ulp for log10.
+    // Subnormal arguments and results are handled correctly, special values follow std::exp and std::log.
+    VCTR_TARGET ("avx") static AVXRegister exp (AVXRegister x) { return { computeExp (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister ln (AVXRegister x) { return { computeLn (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister log2 (AVXRegister x) { return { computeLog2 (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister log10 (AVXRegister x) { return { computeLog10 (x.value) }; }
+
+    /** Raises base to the power of exponent, computed as exp (exponent * ln (|base|)) with ln (|base|) carried in extended
+        precision. The max. error is 4 ulp for results in [1e-43, 1e43] and grows up to 20 ulp towards the limits of the
+        double range. Special values follow std::pow.
+     */
+    VCTR_TARGET ("avx") static AVXRegister pow (AVXRegister base, AVXRegister exponent) { return { computePow (base.value, exponent.value) }; }
+
+    //==============================================================================
+    // Trigonometric Functions
+    // Polynomial approximations based on the Cephes math library after a reduction of the argument to
+    // [-pi / 4, pi / 4]. Measured against a long double reference, the max. error is 3 ulp for sin and cos
+    // and 4 ulp for tan. Lanes with arguments above 2^30, where the reduction gets inaccurate, and inf are
+    // computed with the std functions.
+    VCTR_TARGET ("avx") static AVXRegister sin (AVXRegister x)
+    {
+        return { computeLargeArgumentsWithStd (x.value, computeSinCos (x.value).sin, [] (double v) { return std::sin (v); }) };
+    }
+
+    VCTR_TARGET ("avx") static AVXRegister cos (AVXRegister x)
+    {
+        return { computeLargeArgumentsWithStd (x.value, computeSinCos (x.value).cos, [] (double v) { return std::cos (v); }) };
+    }
+
+    /** Returns the sine and the cosine of x, sharing the argument reduction between both. */
+    VCTR_TARGET ("avx") static std::pair<AVXRegister, AVXRegister> sinCos (AVXRegister x)
+    {
+        const auto [s, c] = computeSinCos (x.value);
+
+        return { { computeLargeArgumentsWithStd (x.value, s, [] (double v) { return std::sin (v); }) },
+                 { computeLargeArgumentsWithStd (x.value, c, [] (double v) { return std::cos (v); }) } };
+    }
+
+    VCTR_TARGET ("avx") static AVXRegister tan (AVXRegister x) { return { computeTan (x.value) }; }
+
+private:
+    // Kernels on the native type wrapped by the public functions above, see AVXRegister<float> for the reason
+    VCTR_TARGET ("avx") static __m256d computeExp (__m256d x)
+    {
+        // Beyond this range the result is inf or 0 anyway, clamping keeps the exponent computation below valid
+        const auto v = _mm256_min_pd (_mm256_set1_pd (710.0), _mm256_max_pd (_mm256_set1_pd (-746.0), x));
+
+        // exp (v) = 2^n * exp (r) with r = v - n * ln (2), ln (2) being split into an exact high and a low part
+        const auto n = _mm256_round_pd (_mm256_mul_pd (v, _mm256_set1_pd (1.4426950408889634074)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        auto r = _mm256_sub_pd (v, _mm256_mul_pd (n, _mm256_set1_pd (6.93145751953125e-1)));
+        r = _mm256_sub_pd (r, _mm256_mul_pd (n, _mm256_set1_pd (1.42860682030941723212e-6)));
+
+        // Padé approximation exp (r) = 1 + 2 * r * P (r^2) / (Q (r^2) - r * P (r^2))
+        const auto rr = _mm256_mul_pd (r, r);
+        auto p = _mm256_set1_pd (1.26177193074810590878e-4);
+        p = _mm256_add_pd (_mm256_mul_pd (p, rr), _mm256_set1_pd (3.02994407707441961300e-2));
+        p = _mm256_add_pd (_mm256_mul_pd (p, rr), _mm256_set1_pd (9.99999999999999999910e-1));
+        p = _mm256_mul_pd (p, r);
+
+        auto q = _mm256_set1_pd (3.00198505138664455042e-6);
+        q = _mm256_add_pd (_mm256_mul_pd (q, rr), _mm256_set1_pd (2.52448340349684104192e-3));
+        q = _mm256_add_pd (_mm256_mul_pd (q, rr), _mm256_set1_pd (2.27265548208155028766e-1));
+        q = _mm256_add_pd (_mm256_mul_pd (q, rr), _mm256_set1_pd (2.00000000000000000009e0));
+
+        auto y = _mm256_div_pd (p, _mm256_sub_pd (q, p));
+        y = _mm256_add_pd (_mm256_add_pd (y, y), _mm256_set1_pd (1.0));
+
+        // Scaling in two steps lets the result overflow to inf or underflow into the subnormal range
+        const auto n1 = _mm256_floor_pd (_mm256_mul_pd (n, _mm256_set1_pd (0.5)));
+        return _mm256_mul_pd (_mm256_mul_pd (y, pow2 (n1)), pow2 (_mm256_sub_pd (n, n1)));
+    }
+
+    VCTR_TARGET ("avx") static __m256d computeLn (__m256d x)
+    {
+        const auto [f, t, e] = decomposeLog (x);
+
+        // ln (x) = e * ln (2) + f + t, ln (2) being split into an exact high and a low part
+        auto y = _mm256_add_pd (t, _mm256_mul_pd (e, _mm256_set1_pd (-2.121944400546905827679e-4)));
+        y = _mm256_add_pd (y, f);
+        y = _mm256_add_pd (y, _mm256_mul_pd (e, _mm256_set1_pd (0.693359375)));
+
+        return handleLogSpecialValues (x, y);
+    }
+
+    VCTR_TARGET ("avx") static __m256d computeLog2 (__m256d x)
+    {
+        const auto [f, t, e] = decomposeLog (x);
+
+        // log2 (x) = e + (f + t) * log2 (e), log2 (e) being split into 1 and a low part
+        auto y = _mm256_mul_pd (t, _mm256_set1_pd (4.4269504088896340735992e-1));
+        y = _mm256_add_pd (y, _mm256_mul_pd (f, _mm256_set1_pd (4.4269504088896340735992e-1)));
+        y = _mm256_add_pd (y, t);
+        y = _mm256_add_pd (y, f);
+        y = _mm256_add_pd (y, e);
+
+        return handleLogSpecialValues (x, y);
+    }
+
+    VCTR_TARGET ("avx") static __m256d computeLog10 (__m256d x)
+    {
+        const auto [f, t, e] = decomposeLog (x);
+
+        // log10 (x) = e * log10 (2) + (f + t) * log10 (e), both constants being split into an exact high and a low part
+        auto y = _mm256_mul_pd (_mm256_add_pd (f, t), _mm256_set1_pd (7.00731903251827651129e-4));
+        y = _mm256_add_pd (y, _mm256_mul_pd (t, _mm256_set1_pd (4.3359375e-1)));
+        y = _mm256_add_pd (y, _mm256_mul_pd (f, _mm256_set1_pd (4.3359375e-1)));
+        y = _mm256_add_pd (y, _mm256_mul_pd (e, _mm256_set1_pd (2.48745663981195213739e-4)));
+        y = _mm256_add_pd (y, _mm256_mul_pd (e, _mm256_set1_pd (3.0078125e-1)));
+
+        return handleLogSpecialValues (x, y);
+    }
+
+    VCTR_TARGET ("avx") static __m256d computePow (__m256d base, __m256d exponent)
+    {
+        const auto x = _mm256_andnot_pd (_mm256_set1_pd (-0.0), base);
+        const auto [f, e] = splitLogArgument (x);
+
+        // ln (1 + f) = 2 * s + s * R (s^2) with s = f / (2 + f) and the minimax polynomial R from fdlibm. 2 * s is
+        // computed as sHi + sLo by recovering the rounding errors of 2 + f and of the division
+        const auto two = _mm256_set1_pd (2.0);
+        const auto d = _mm256_add_pd (two, f);
+        const auto dLo = _mm256_sub_pd (f, _mm256_sub_pd (d, two));
+        const auto sHi = _mm256_div_pd (_mm256_add_pd (f, f), d);
+        const auto [q, qLo] = exactProduct (sHi, d);
+        const auto sLo = _mm256_div_pd (_mm256_sub_pd (_mm256_sub_pd (_mm256_sub_pd (_mm256_add_pd (f, f), q), qLo), _mm256_mul_pd (sHi, dLo)), d);
+
+        const auto s = _mm256_mul_pd (sHi, _mm256_set1_pd (0.5));
+        const auto z = _mm256_mul_pd (s, s);
+        auto r = _mm256_set1_pd (1.479819860511658591e-1);
+        r = _mm256_add_pd (_mm256_mul_pd (r, z), _mm256_set1_pd (1.531383769920937332e-1));
+        r = _mm256_add_pd (_mm256_mul_pd (r, z), _mm256_set1_pd (1.818357216161805012e-1));
+        r = _mm256_add_pd (_mm256_mul_pd (r, z), _mm256_set1_pd (2.222219843214978396e-1));
+        r = _mm256_add_pd (_mm256_mul_pd (r, z), _mm256_set1_pd (2.857142874366239149e-1));
+        r = _mm256_add_pd (_mm256_mul_pd (r, z), _mm256_set1_pd (3.999999999940941908e-1));
+        r = _mm256_add_pd (_mm256_mul_pd (r, z), _mm256_set1_pd (6.666666666666735130e-1));
+        r = _mm256_mul_pd (_mm256_mul_pd (r, z), s);
+
+        // s is only the high part of f / (2 + f), the first order term of s * R (s^2) in the low part is added here
+        r = _mm256_add_pd (r, _mm256_mul_pd (z, sLo));
+
+        // ln (x) = lnHi + lnLo = e * ln (2) + sHi + sLo + s * R (s^2). The high part of e * ln (2) and sHi are summed up
+        // first, the rounding errors of both sums are kept in lnLo
+        const auto eLn2 = _mm256_mul_pd (e, _mm256_set1_pd (0.693359375));
+        const auto tail = _mm256_add_pd (_mm256_add_pd (sLo, r), _mm256_mul_pd (e, _mm256_set1_pd (-2.121944400546905827679e-4)));
+        const auto head = _mm256_add_pd (eLn2, sHi);
+        const auto sum = _mm256_add_pd (head, tail);
+        const auto lnLo = _mm256_add_pd (_mm256_add_pd (_mm256_sub_pd (eLn2, head), sHi), _mm256_add_pd (_mm256_sub_pd (head, sum), tail));
+        const auto lnHi = handleLogSpecialValues (x, sum);
+
+        // exponent * ln (x) = p + c and exp (p + c) = exp (p) * (1 + c). The correction c is tiny, unless splitting the
+        // factors of the exact product overflowed. This only happens where exp (p) is inf, 0 or 1 anyway, so it is masked out
+        const auto [p, pLo] = exactProduct (exponent, lnHi);
+        auto c = _mm256_add_pd (pLo, _mm256_mul_pd (exponent, lnLo));
+        c = _mm256_and_pd (c, _mm256_cmp_pd (_mm256_andnot_pd (_mm256_set1_pd (-0.0), c), _mm256_set1_pd (1.0), _CMP_LT_OQ));
+        const auto y = _mm256_mul_pd (computeExp (p), _mm256_add_pd (_mm256_set1_pd (1.0), c));
+
+        return handlePowSpecialValues (base, exponent, y);
+    }
+
+    VCTR_TARGET ("avx") static __m256d computeTan (__m256d x)
+    {
+        const auto [n, r] = reduceToQuadrant (x);
+
+        // Rational approximation tan (r) = r + r * z * P (z) / Q (z) with z = r^2
+        const auto z = _mm256_mul_pd (r, r);
+        auto p = _mm256_set1_pd (-1.30936939181383777646e4);
+        p = _mm256_add_pd (_mm256_mul_pd (p, z), _mm256_set1_pd (1.15351664838587416140e6));
+        p = _mm256_add_pd (_mm256_mul_pd (p, z), _mm256_set1_pd (-1.79565251976484877988e7));
+
+        auto q = _mm256_add_pd (z, _mm256_set1_pd (1.36812963470692954678e4));
+        q = _mm256_add_pd (_mm256_mul_pd (q, z), _mm256_set1_pd (-1.32089234440210967447e6));
+        q = _mm256_add_pd (_mm256_mul_pd (q, z), _mm256_set1_pd (2.50083801823357915839e7));
+        q = _mm256_add_pd (_mm256_mul_pd (q, z), _mm256_set1_pd (-5.38695755929454629881e7));
+
+        const auto t = _mm256_add_pd (_mm256_mul_pd (r, _mm256_div_pd (_mm256_mul_pd (z, p), q)), r);
+
+        // tan (x) = -1 / tan (r) in odd quadrants
+        const auto isOddQuadrant = _mm256_cmp_pd (n, _mm256_mul_pd (_mm256_floor_pd (_mm256_mul_pd (n, _mm256_set1_pd (0.5))), _mm256_set1_pd (2.0)), _CMP_NEQ_UQ);
+        const auto y = _mm256_or_pd (_mm256_andnot_pd (isOddQuadrant, t), _mm256_and_pd (isOddQuadrant, _mm256_div_pd (_mm256_set1_pd (-1.0), t)));
+
+        return computeLargeArgumentsWithStd (x, y, [] (double v) { return std::tan (v); });
+    }
+
+    struct LogDecomposition
+    {
+        __m256d f, t, e;
+    };
+
+    /** Returns 2^n for integer values n in the normal exponent range by writing n + 1023 into the exponent bits. */
+    VCTR_TARGET ("avx") static __m256d pow2 (__m256d n)
+    {
+        // There are no 256 bit integer operations in AVX, so the two halves are built with SSE instructions
+        const auto biased = _mm_add_epi32 (_mm256_cvtpd_epi32 (n), _mm_set1_epi32 (1023));
+        const auto low = _mm_slli_epi64 (_mm_cvtepi32_epi64 (biased), 52);
+        const auto high = _mm_slli_epi64 (_mm_cvtepi32_epi64 (_mm_unpackhi_epi64 (biased, biased)), 52);
+        return _mm256_castsi256_pd (_mm256_set_m128i (high, low));
+    }
+
+    struct LogArgument
+    {
+        __m256d f, e;
+    };
+
+    /** Splits x into 2^e * (1 + f) with 1 + f in [sqrt (0.5), sqrt (2)). */
+    VCTR_TARGET ("avx") static LogArgument splitLogArgument (__m256d x)
+    {
+        // Subnormal values are scaled by 2^54 into the normal range first
+        const auto isSubnormal = _mm256_cmp_pd (x, _mm256_set1_pd (std::numeric_limits<double>::min()), _CMP_LT_OQ);
+        x = _mm256_or_pd (_mm256_and_pd (isSubnormal, _mm256_mul_pd (x, _mm256_set1_pd (18014398509481984.0))), _mm256_andnot_pd (isSubnormal, x));
+
+        // x = 2^e * m with m in [0.5, 1). The upper 32 bits of the masked exponent are converted to double as an integer, which is exact
+        const auto exponentMask = _mm256_castsi256_pd (_mm256_set1_epi64x (0x7ff0000000000000));
+        const auto m = _mm256_or_pd (_mm256_andnot_pd (exponentMask, x), _mm256_set1_pd (0.5));
+        const auto exponentBits = _mm256_castpd_ps (_mm256_and_pd (x, exponentMask));
+        const auto upperWords = _mm_shuffle_ps (_mm256_castps256_ps128 (exponentBits), _mm256_extractf128_ps (exponentBits, 1), _MM_SHUFFLE (3, 1, 3, 1));
+        auto e = _mm256_cvtepi32_pd (_mm_castps_si128 (upperWords));
+        e = _mm256_mul_pd (e, _mm256_set1_pd (9.5367431640625e-7));
+        e = _mm256_sub_pd (e, _mm256_add_pd (_mm256_set1_pd (1022.0), _mm256_and_pd (isSubnormal, _mm256_set1_pd (54.0))));
+
+        // Mantissas below sqrt (0.5) are doubled, so that f = m - 1 is centered around zero
+        const auto isBelowSqrtHalf = _mm256_cmp_pd (m, _mm256_set1_pd (0.70710678118654752440), _CMP_LT_OQ);
+        e = _mm256_sub_pd (e, _mm256_and_pd (isBelowSqrtHalf, _mm256_set1_pd (1.0)));
+        const auto f = _mm256_add_pd (_mm256_sub_pd (m, _mm256_set1_pd (1.0)), _mm256_and_pd (isBelowSqrtHalf, m));
+
+        return { f, e };
+    }
+
+    /** Splits x into 2^e * (1 + f) with 1 + f in [sqrt (0.5), sqrt (2)) and computes t = ln (1 + f) - f. */
+    VCTR_TARGET ("avx") static LogDecomposition decomposeLog (__m256d x)
+    {
+        const auto [f, e] = splitLogArgument (x);
+
+        // Rational approximation t = f * z * P (f) / Q (f) - z / 2 with z = f^2
+        const auto z = _mm256_mul_pd (f, f);
+        auto p = _mm256_set1_pd (1.01875663804580931796e-4);
+        p = _mm256_add_pd (_mm256_mul_pd (p, f), _mm256_set1_pd (4.97494994976747001425e-1));
+        p = _mm256_add_pd (_mm256_mul_pd (p, f), _mm256_set1_pd (4.70579119878881725854e0));
+        p = _mm256_add_pd (_mm256_mul_pd (p, f), _mm256_set1_pd (1.44989225341610930846e1));
+        p = _mm256_add_pd (_mm256_mul_pd (p, f), _mm256_set1_pd (1.79368678507819816313e1));
+        p = _mm256_add_pd (_mm256_mul_pd (p, f), _mm256_set1_pd (7.70838733755885391666e0));
+
+        auto q = _mm256_add_pd (f, _mm256_set1_pd (1.12873587189167450590e1));
+        q = _mm256_add_pd (_mm256_mul_pd (q, f), _mm256_set1_pd (4.52279145837532221105e1));
+        q = _mm256_add_pd (_mm256_mul_pd (q, f), _mm256_set1_pd (8.29875266912776603211e1));
+        q = _mm256_add_pd (_mm256_mul_pd (q, f), _mm256_set1_pd (7.11544750618563894466e1));
+        q = _mm256_add_pd (_mm256_mul_pd (q, f), _mm256_set1_pd (2.31251620126765340583e1));
+
+        const auto t = _mm256_sub_pd (_mm256_mul_pd (f, _mm256_div_pd (_mm256_mul_pd (z, p), q)), _mm256_mul_pd (z, _mm256_set1_pd (0.5)));
+
+        return { f, t, e };
+    }
+
+    /** Returns -inf for zero, inf for inf and NaN for negative and NaN arguments, y otherwise. */
+    VCTR_TARGET ("avx") static __m256d handleLogSpecialValues (__m256d x, __m256d y)
+    {
+        const auto zero = _mm256_setzero_pd();
+        const auto inf = _mm256_set1_pd (std::numeric_limits<double>::infinity());
+
+        const auto isZero = _mm256_cmp_pd (x, zero, _CMP_EQ_OQ);
+        const auto isInf = _mm256_cmp_pd (x, inf, _CMP_EQ_OQ);
+
+        // A mask with all bits set is a NaN bit pattern, so or-ing it into y turns invalid lanes into NaN
+        y = _mm256_or_pd (_mm256_andnot_pd (isZero, y), _mm256_and_pd (isZero, _mm256_sub_pd (zero, inf)));
+        y = _mm256_or_pd (_mm256_andnot_pd (isInf, y), _mm256_and_pd (isInf, inf));
+        return _mm256_or_pd (y, _mm256_cmp_pd (x, zero, _CMP_NGE_UQ));
+    }
+
+    /** Takes y = |x|^e and applies the sign for negative x raised to odd integers, NaN for finite negative x raised to
+        non integers and 1 for pow (x, 0), pow (1, e) and pow (-1, +-inf), as std::pow does.
+     */
+    VCTR_TARGET ("avx") static __m256d handlePowSpecialValues (__m256d x, __m256d e, __m256d y)
+    {
+        const auto one = _mm256_set1_pd (1.0);
+        const auto inf = _mm256_set1_pd (std::numeric_limits<double>::infinity());
+        const auto signBit = _mm256_set1_pd (-0.0);
+
+        const auto eHalf = _mm256_mul_pd (e, _mm256_set1_pd (0.5));
+        const auto isInteger = _mm256_cmp_pd (_mm256_floor_pd (e), e, _CMP_EQ_OQ);
+        const auto isOddInteger = _mm256_and_pd (isInteger, _mm256_cmp_pd (_mm256_floor_pd (eHalf), eHalf, _CMP_NEQ_UQ));
+        const auto isFiniteNegative = _mm256_and_pd (_mm256_cmp_pd (x, _mm256_setzero_pd(), _CMP_LT_OQ), _mm256_cmp_pd (x, _mm256_sub_pd (_mm256_setzero_pd(), inf), _CMP_GT_OQ));
+
+        y = _mm256_xor_pd (y, _mm256_and_pd (isOddInteger, _mm256_and_pd (x, signBit)));
+        y = _mm256_or_pd (y, _mm256_andnot_pd (isInteger, isFiniteNegative));
+
+        const auto isMinusOneToInf = _mm256_and_pd (_mm256_cmp_pd (x, _mm256_set1_pd (-1.0), _CMP_EQ_OQ), _mm256_cmp_pd (_mm256_andnot_pd (signBit, e), inf, _CMP_EQ_OQ));
+        const auto isOne = _mm256_or_pd (_mm256_or_pd (_mm256_cmp_pd (e, _mm256_setzero_pd(), _CMP_EQ_OQ), _mm256_cmp_pd (x, one, _CMP_EQ_OQ)), isMinusOneToInf);
+        return _mm256_or_pd (_mm256_andnot_pd (isOne, y), _mm256_and_pd (isOne, one));
+    }
+
+    struct ExactProduct
+    {
+        __m256d hi, lo;
+    };
+
+    /** Computes a * b = hi + lo without rounding error with Dekker's algorithm, as long as splitting a and b does not overflow. */
+    VCTR_TARGET ("avx") static ExactProduct exactProduct (__m256d a, __m256d b)
+    {
+        const auto splitFactor = _mm256_set1_pd (134217729.0);
+        const auto aScaled = _mm256_mul_pd (a, splitFactor);
+        const auto bScaled = _mm256_mul_pd (b, splitFactor);
+        const auto aHi = _mm256_sub_pd (aScaled, _mm256_sub_pd (aScaled, a));
+        const auto bHi = _mm256_sub_pd (bScaled, _mm256_sub_pd (bScaled, b));
+        const auto aLo = _mm256_sub_pd (a, aHi);
+        const auto bLo = _mm256_sub_pd (b, bHi);
+
+        const auto hi = _mm256_mul_pd (a, b);
+        auto lo = _mm256_sub_pd (_mm256_mul_pd (aHi, bHi), hi);
+        lo = _mm256_add_pd (lo, _mm256_mul_pd (aHi, bLo));
+        lo = _mm256_add_pd (lo, _mm256_mul_pd (aLo, bHi));
+        lo = _mm256_add_pd (lo, _mm256_mul_pd (aLo, bLo));
+
+        return { hi, lo };
+    }
+
+    struct QuadrantReduction
+    {
+        __m256d n, r;
+    };
+
+    struct SinCosResult
+    {
+        __m256d sin, cos;
+    };
+
+    /** Splits x into n * pi / 2 + r with r in [-pi / 4, pi / 4]. pi / 2 is split into four parts, the products of the first three are exact. */
+    VCTR_TARGET ("avx") static QuadrantReduction reduceToQuadrant (__m256d x)
+    {
+        const auto n = _mm256_round_pd (_mm256_mul_pd (x, _mm256_set1_pd (0.63661977236758134308)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        auto r = _mm256_sub_pd (x, _mm256_mul_pd (n, _mm256_set1_pd (1.570796251296997)));
+        r = _mm256_sub_pd (r, _mm256_mul_pd (n, _mm256_set1_pd (7.549789415861596e-8)));
+        r = _mm256_sub_pd (r, _mm256_mul_pd (n, _mm256_set1_pd (5.390302529957765e-15)));
+        r = _mm256_sub_pd (r, _mm256_mul_pd (n, _mm256_set1_pd (3.2820035428735005e-22)));
+
+        return { n, r };
+    }
+
+    VCTR_TARGET ("avx") static SinCosResult computeSinCos (__m256d x)
+    {
+        const auto [n, r] = reduceToQuadrant (x);
+        const auto z = _mm256_mul_pd (r, r);
+
+        auto s = _mm256_set1_pd (1.58962301576546568060e-10);
+        s = _mm256_add_pd (_mm256_mul_pd (s, z), _mm256_set1_pd (-2.50507477628578072866e-8));
+        s = _mm256_add_pd (_mm256_mul_pd (s, z), _mm256_set1_pd (2.75573136213857245213e-6));
+        s = _mm256_add_pd (_mm256_mul_pd (s, z), _mm256_set1_pd (-1.98412698295895385996e-4));
+        s = _mm256_add_pd (_mm256_mul_pd (s, z), _mm256_set1_pd (8.33333333332211858878e-3));
+        s = _mm256_add_pd (_mm256_mul_pd (s, z), _mm256_set1_pd (-1.66666666666666307295e-1));
+        s = _mm256_add_pd (_mm256_mul_pd (_mm256_mul_pd (s, z), r), r);
+
+        auto c = _mm256_set1_pd (-1.13585365213876817300e-11);
+        c = _mm256_add_pd (_mm256_mul_pd (c, z), _mm256_set1_pd (2.08757008419747316778e-9));
+        c = _mm256_add_pd (_mm256_mul_pd (c, z), _mm256_set1_pd (-2.75573141792967388112e-7));
+        c = _mm256_add_pd (_mm256_mul_pd (c, z), _mm256_set1_pd (2.48015872888517045348e-5));
+        c = _mm256_add_pd (_mm256_mul_pd (c, z), _mm256_set1_pd (-1.38888888888730564116e-3));
+        c = _mm256_add_pd (_mm256_mul_pd (c, z), _mm256_set1_pd (4.16666666666665929218e-2));
+        c = _mm256_add_pd (_mm256_sub_pd (_mm256_mul_pd (_mm256_mul_pd (c, z), z), _mm256_mul_pd (z, _mm256_set1_pd (0.5))), _mm256_set1_pd (1.0));
+
+        // In odd quadrants sin and cos swap roles. sin is negative in quadrants 2 and 3, cos in quadrants 1 and 2
+        const auto nHalf = _mm256_floor_pd (_mm256_mul_pd (n, _mm256_set1_pd (0.5)));
+        const auto nQuarter = _mm256_floor_pd (_mm256_mul_pd (n, _mm256_set1_pd (0.25)));
+        const auto isOddQuadrant = _mm256_cmp_pd (n, _mm256_add_pd (nHalf, nHalf), _CMP_NEQ_UQ);
+        const auto isSinNegative = _mm256_cmp_pd (nHalf, _mm256_add_pd (nQuarter, nQuarter), _CMP_NEQ_UQ);
+        const auto isCosNegative = _mm256_xor_pd (isOddQuadrant, isSinNegative);
+        const auto signBit = _mm256_set1_pd (-0.0);
+
+        const auto sinResult = _mm256_or_pd (_mm256_andnot_pd (isOddQuadrant, s), _mm256_and_pd (isOddQuadrant, c));
+        const auto cosResult = _mm256_or_pd (_mm256_andnot_pd (isOddQuadrant, c), _mm256_and_pd (isOddQuadrant, s));
+
+        return { _mm256_xor_pd (sinResult, _mm256_and_pd (isSinNegative, signBit)), _mm256_xor_pd (cosResult, _mm256_and_pd (isCosNegative, signBit)) };
+    }
+
+    /** Replaces the lanes of y with the result of stdFn for all lanes where the absolute value of x is too large for reduceToQuadrant or inf. */
+    template <class StdFn>
+    VCTR_TARGET ("avx") static __m256d computeLargeArgumentsWithStd (__m256d x, __m256d y, StdFn&& stdFn)
+    {
+        const auto isLarge = _mm256_movemask_pd (_mm256_cmp_pd (_mm256_andnot_pd (_mm256_set1_pd (-0.0), x), _mm256_set1_pd (1073741824.0), _CMP_GT_OQ));
+
+        if (isLarge == 0)
+            return y;
+
+        alignas (32) double xs[numElements], ys[numElements];
+        _mm256_store_pd (xs, x);
+        _mm256_store_pd (ys, y);
+
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            if (isLarge & (1 << i))
+                ys[i] = stdFn (xs[i]);
+        }
+
+        return _mm256_load_pd (ys);
+    }
 };
 
+//==============================================================================
+// Defined out of class, since the float lanes are evaluated with the AVXRegister<double> functions
+VCTR_TARGET ("avx") inline __m256 AVXRegister<float>::computePow (__m256 base, __m256 exponent)
+{
+    using Double = AVXRegister<double>;
+
+    const auto absBase = _mm256_andnot_ps (_mm256_set1_ps (-0.0f), base);
+    const auto lnLow = Double::ln ({ _mm256_cvtps_pd (_mm256_castps256_ps128 (absBase)) });
+    const auto lnHigh = Double::ln ({ _mm256_cvtps_pd (_mm256_extractf128_ps (absBase, 1)) });
+    const auto low = Double::exp ({ _mm256_mul_pd (_mm256_cvtps_pd (_mm256_castps256_ps128 (exponent)), lnLow.value) });
+    const auto high = Double::exp ({ _mm256_mul_pd (_mm256_cvtps_pd (_mm256_extractf128_ps (exponent, 1)), lnHigh.value) });
+
+    return handlePowSpecialValues (base, exponent, _mm256_set_m128 (_mm256_cvtpd_ps (high.value), _mm256_cvtpd_ps (low.value)));
+}
+
 template <>
 struct AVXRegister<int32_t>
 {
@@ -119,14 +984,40 @@ struct AVXRegister<int32_t>
     VCTR_TARGET ("avx") static AVXRegister broadcast     (int32_t x)                                      { return { _mm256_set1_epi32 (x) }; }
     VCTR_TARGET ("avx") static AVXRegister fromSSE       (SSERegister<int32_t> a, SSERegister<int32_t> b) { return { _mm256_set_m128i (a.value, b.value) }; }
 
+    // Loads the elements whose mask element has the sign bit set and takes all others from fill. Memory of unselected
+    // elements is not accessed.
+    VCTR_TARGET ("avx2") static AVXRegister loadUnalignedMasked (const int32_t* d, __m256i mask, AVXRegister fill) { return { _mm256_castps_si256 (_mm256_blendv_ps (_mm256_castsi256_ps (fill.value), _mm256_castsi256_ps (_mm256_maskload_epi32 (d, mask)), _mm256_castsi256_ps (mask))) }; }
+
     //==============================================================================
     // Storing
     VCTR_TARGET ("avx") void storeUnaligned (int32_t* d) const { _mm256_storeu_si256 (reinterpret_cast<__m256i*> (d), value); }
     VCTR_TARGET ("avx") void storeAligned   (int32_t* d) const { _mm256_store_si256  (reinterpret_cast<__m256i*> (d), value); }
 
+    // Stores the elements whose mask element has the sign bit set. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx2") void storeUnalignedMasked (int32_t* d, __m256i mask) const { _mm256_maskstore_epi32 (d, mask, value); }
+
     //==============================================================================
     // Bit Operations
 
+    //==============================================================================
+    // Comparison
+    VCTR_TARGET ("avx2") static AVXRegister greaterThan (AVXRegister a, AVXRegister b) { return { _mm256_cmpgt_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx2") static AVXRegister lessThan    (AVXRegister a, AVXRegister b) { return { _mm256_cmpgt_epi32 (b.value, a.value) }; }
+
+    // Returns one bit per element, set if the element of a comparison result is true
+    VCTR_TARGET ("avx") static uint32_t toBitMask (AVXRegister mask) { return uint32_t (_mm256_movemask_ps (_mm256_castsi256_ps (mask.value))); }
+
+    //==============================================================================
+    // Element Permutation, used by sorting networks. swapAdjacentGroups exchanges each group of n adjacent elements
+    // with its neighbouring group, so that element i ends up at index i ^ n. blend takes the elements whose bit is set in
+    // mask from b and all others from a. permute moves the element at index indices[i] to index i.
+    template <int n>
+    VCTR_TARGET ("avx2") static AVXRegister swapAdjacentGroups (AVXRegister x)                          { return { n == 1 ? _mm256_shuffle_epi32 (x.value, 0xB1) : n == 2 ? _mm256_shuffle_epi32 (x.value, 0x4E) : _mm256_permute2x128_si256 (x.value, x.value, 0x01) }; }
+    VCTR_TARGET ("avx2") static AVXRegister reverse            (AVXRegister x)                          { return { _mm256_permutevar8x32_epi32 (x.value, _mm256_set_epi32 (0, 1, 2, 3, 4, 5, 6, 7)) }; }
+    template <int mask>
+    VCTR_TARGET ("avx2") static AVXRegister blend              (AVXRegister a, AVXRegister b)           { return { _mm256_blend_epi32 (a.value, b.value, mask) }; }
+    VCTR_TARGET ("avx2") static AVXRegister permute            (AVXRegister x, const int32_t* indices) { return { _mm256_permutevar8x32_epi32 (x.value, _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (indices))) }; }
+
     //==============================================================================
     // Math
     VCTR_TARGET ("avx2") static AVXRegister abs (AVXRegister x)                { return { _mm256_abs_epi32 (x.value) }; }
@@ -153,14 +1044,40 @@ struct AVXRegister<uint32_t>
     VCTR_TARGET ("avx") static AVXRegister broadcast     (uint32_t x)                                       { return { _mm256_set1_epi32 ((int32_t) x) }; }
     VCTR_TARGET ("avx") static AVXRegister fromSSE       (SSERegister<uint32_t> a, SSERegister<uint32_t> b) { return { _mm256_set_m128i (a.value, b.value) }; }
 
+    // Loads the elements whose mask element has the sign bit set and takes all others from fill. Memory of unselected
+    // elements is not accessed.
+    VCTR_TARGET ("avx2") static AVXRegister loadUnalignedMasked (const uint32_t* d, __m256i mask, AVXRegister fill) { return { _mm256_castps_si256 (_mm256_blendv_ps (_mm256_castsi256_ps (fill.value), _mm256_castsi256_ps (_mm256_maskload_epi32 (reinterpret_cast<const int*> (d), mask)), _mm256_castsi256_ps (mask))) }; }
+
     //==============================================================================
     // Storing
     VCTR_TARGET ("avx") void storeUnaligned (uint32_t* d) const { _mm256_storeu_si256 (reinterpret_cast<__m256i*> (d), value); }
     VCTR_TARGET ("avx") void storeAligned   (uint32_t* d) const { _mm256_store_si256  (reinterpret_cast<__m256i*> (d), value); }
 
+    // Stores the elements whose mask element has the sign bit set. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx2") void storeUnalignedMasked (uint32_t* d, __m256i mask) const { _mm256_maskstore_epi32 (reinterpret_cast<int*> (d), mask, value); }
+
     //==============================================================================
     // Bit Operations
 
+    //==============================================================================
+    // Comparison. There is no unsigned comparison, flipping the sign bits maps the unsigned order to the signed order.
+    VCTR_TARGET ("avx2") static AVXRegister greaterThan (AVXRegister a, AVXRegister b) { return { _mm256_cmpgt_epi32 (_mm256_xor_si256 (a.value, _mm256_set1_epi32 (std::numeric_limits<int32_t>::min())), _mm256_xor_si256 (b.value, _mm256_set1_epi32 (std::numeric_limits<int32_t>::min()))) }; }
+    VCTR_TARGET ("avx2") static AVXRegister lessThan    (AVXRegister a, AVXRegister b) { return greaterThan (b, a); }
+
+    // Returns one bit per element, set if the element of a comparison result is true
+    VCTR_TARGET ("avx") static uint32_t toBitMask (AVXRegister mask) { return uint32_t (_mm256_movemask_ps (_mm256_castsi256_ps (mask.value))); }
+
+    //==============================================================================
+    // Element Permutation, used by sorting networks. swapAdjacentGroups exchanges each group of n adjacent elements
+    // with its neighbouring group, so that element i ends up at index i ^ n. blend takes the elements whose bit is set in
+    // mask from b and all others from a. permute moves the element at index indices[i] to index i.
+    template <int n>
+    VCTR_TARGET ("avx2") static AVXRegister swapAdjacentGroups (AVXRegister x)                          { return { n == 1 ? _mm256_shuffle_epi32 (x.value, 0xB1) : n == 2 ? _mm256_shuffle_epi32 (x.value, 0x4E) : _mm256_permute2x128_si256 (x.value, x.value, 0x01) }; }
+    VCTR_TARGET ("avx2") static AVXRegister reverse            (AVXRegister x)                          { return { _mm256_permutevar8x32_epi32 (x.value, _mm256_set_epi32 (0, 1, 2, 3, 4, 5, 6, 7)) }; }
+    template <int mask>
+    VCTR_TARGET ("avx2") static AVXRegister blend              (AVXRegister a, AVXRegister b)           { return { _mm256_blend_epi32 (a.value, b.value, mask) }; }
+    VCTR_TARGET ("avx2") static AVXRegister permute            (AVXRegister x, const int32_t* indices) { return { _mm256_permutevar8x32_epi32 (x.value, _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (indices))) }; }
+
     //==============================================================================
     // Math
     VCTR_TARGET ("avx2") static AVXRegister add (AVXRegister a, AVXRegister b) { return { _mm256_add_epi32 (a.value, b.value) }; }
@@ -0,0 +1,682 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+template <class T>
+struct AVX512Register
+{
+    static constexpr AVX512Register broadcast (const T&) { return {}; }
+};
+
+#if VCTR_X64
+
+template <>
+struct AVX512Register<float>
+{
+    static constexpr size_t numElements = 16;
+
+    using NativeType = __m512;
+    __m512 value;
+
+    //==============================================================================
+    // Loading
+    // clang-format off
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnaligned (const float* d)                             { return { _mm512_loadu_ps (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register loadAligned   (const float* d)                             { return { _mm512_load_ps (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register broadcast     (float x)                                    { return { _mm512_set1_ps (x) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fromAVX       (AVXRegister<float> a, AVXRegister<float> b) { return { _mm512_castpd_ps (_mm512_insertf64x4 (_mm512_castps_pd (_mm512_castps256_ps512 (b.value)), _mm256_castps_pd (a.value), 1)) }; }
+
+    // Loads the elements selected by mask and takes all others from fill. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnalignedMasked (const float* d, __mmask16 mask, AVX512Register fill) { return { _mm512_mask_loadu_ps (fill.value, mask, d) }; }
+
+    //==============================================================================
+    // Storing
+    VCTR_TARGET ("avx512f") void storeUnaligned (float* d) const { _mm512_storeu_ps (d, value); }
+    VCTR_TARGET ("avx512f") void storeAligned   (float* d) const { _mm512_store_ps  (d, value); }
+
+    // Stores the elements selected by mask to consecutive addresses
+    VCTR_TARGET ("avx512f") void storeCompressed (float* d, __mmask16 mask) const { _mm512_mask_compressstoreu_ps (d, mask, value); }
+
+    // Stores the elements selected by mask. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx512f") void storeUnalignedMasked (float* d, __mmask16 mask) const { _mm512_mask_storeu_ps (d, mask, value); }
+
+    //==============================================================================
+    // Half Precision Conversion, values are rounded to the nearest even value when storing
+    VCTR_TARGET ("avx512f") static AVX512Register loadFloat16  (const float16* d)  { return { _mm512_cvtph_ps (_mm256_loadu_si256 (reinterpret_cast<const __m256i*> (d))) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register loadBFloat16 (const bfloat16* d) { return { _mm512_castsi512_ps (_mm512_slli_epi32 (_mm512_cvtepu16_epi32 (_mm256_loadu_si256 (reinterpret_cast<const __m256i*> (d))), 16)) }; }
+
+    VCTR_TARGET ("avx512f") void storeFloat16 (float16* d) const { _mm256_storeu_si256 (reinterpret_cast<__m256i*> (d), _mm512_cvtps_ph (value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+    VCTR_TARGET ("avx512f") void storeBFloat16 (bfloat16* d) const
+    {
+        const auto bits = _mm512_castps_si512 (value);
+        const auto lsb = _mm512_and_si512 (_mm512_srli_epi32 (bits, 16), _mm512_set1_epi32 (1));
+        auto rounded = _mm512_add_epi32 (bits, _mm512_add_epi32 (lsb, _mm512_set1_epi32 (0x7fff)));
+
+        // NaNs are truncated and made quiet, so that rounding can't turn them into infinity
+        rounded = _mm512_mask_mov_epi32 (rounded, _mm512_cmp_ps_mask (value, value, _CMP_UNORD_Q), _mm512_or_si512 (bits, _mm512_set1_epi32 (0x400000)));
+
+        _mm256_storeu_si256 (reinterpret_cast<__m256i*> (d), _mm512_cvtepi32_epi16 (_mm512_srli_epi32 (rounded, 16)));
+    }
+
+    //==============================================================================
+    // Bit Operations
+    VCTR_TARGET ("avx512f") static AVX512Register andNot (AVX512Register a, AVX512Register b) { return { _mm512_castsi512_ps (_mm512_andnot_si512 (_mm512_castps_si512 (a.value), _mm512_castps_si512 (b.value))) }; }
+
+    //==============================================================================
+    // Comparison and Selection, lanes compared against NaN are always false
+    VCTR_TARGET ("avx512f") static __mmask16      greaterThan (AVX512Register a, AVX512Register b)                    { return _mm512_cmp_ps_mask (a.value, b.value, _CMP_GT_OQ); }
+    VCTR_TARGET ("avx512f") static __mmask16      lessThan    (AVX512Register a, AVX512Register b)                    { return _mm512_cmp_ps_mask (a.value, b.value, _CMP_LT_OQ); }
+    VCTR_TARGET ("avx512f") static AVX512Register select      (__mmask16 mask, AVX512Register a, AVX512Register b) { return { _mm512_mask_blend_ps (mask, b.value, a.value) }; }
+
+    //==============================================================================
+    // Element Shifting, used by prefix scans. shiftUp moves all elements n lanes up and fills the lowest lanes with the
+    // highest lanes of fill, which is expected to hold the same value in all lanes.
+    template <int n>
+    VCTR_TARGET ("avx512f") static AVX512Register shiftUp       (AVX512Register x, AVX512Register fill) { return { _mm512_castsi512_ps (_mm512_alignr_epi32 (_mm512_castps_si512 (x.value), _mm512_castps_si512 (fill.value), 16 - n)) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register broadcastLast (AVX512Register x)                      { return { _mm512_permutexvar_ps (_mm512_set1_epi32 (15), x.value) }; }
+
+    //==============================================================================
+    // Element Permutation, used by sorting networks. swapAdjacentGroups exchanges each group of n adjacent elements
+    // with its neighbouring group, so that element i ends up at index i ^ n.
+    template <int n>
+    VCTR_TARGET ("avx512f") static AVX512Register swapAdjacentGroups (AVX512Register x) { return { n == 1 ? _mm512_permute_ps (x.value, 0xB1) : n == 2 ? _mm512_permute_ps (x.value, 0x4E) : n == 4 ? _mm512_shuffle_f32x4 (x.value, x.value, 0xB1) : _mm512_shuffle_f32x4 (x.value, x.value, 0x4E) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register reverse            (AVX512Register x) { return { _mm512_permutexvar_ps (_mm512_set_epi32 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), x.value) }; }
+
+    //==============================================================================
+    // Math
+    VCTR_TARGET ("avx512f") static AVX512Register mul (AVX512Register a, AVX512Register b) { return { _mm512_mul_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register add (AVX512Register a, AVX512Register b) { return { _mm512_add_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register sub (AVX512Register a, AVX512Register b) { return { _mm512_sub_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register div (AVX512Register a, AVX512Register b) { return { _mm512_div_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register max (AVX512Register a, AVX512Register b) { return { _mm512_max_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register min (AVX512Register a, AVX512Register b) { return { _mm512_min_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register sqrt (AVX512Register x)                 { return { _mm512_sqrt_ps (x.value) }; }
+
+    //==============================================================================
+    // Fused Multiply Add, always available with AVX-512F
+    VCTR_TARGET ("avx512f") static AVX512Register fma  (AVX512Register a, AVX512Register b, AVX512Register c) { return { _mm512_fmadd_ps (a.value, b.value, c.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fms  (AVX512Register a, AVX512Register b, AVX512Register c) { return { _mm512_fmsub_ps (a.value, b.value, c.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fnma (AVX512Register a, AVX512Register b, AVX512Register c) { return { _mm512_fnmadd_ps (a.value, b.value, c.value) }; }
+    // clang-format on
+
+    //==============================================================================
+    // Fast Approximations
+    // The rsqrt14 and rcp14 estimates refined by one Newton-Raphson step. Measured against a double reference, the max.
+    // error is 3 ulp for fastSqrt and fastRsqrt and 2 ulp for fastReciprocal. Zero, inf and NaN arguments give the
+    // same results as the exact computation. fastSqrt and fastRsqrt flush subnormal arguments to zero like the SSE and
+    // AVX estimates do, fastReciprocal returns the unrefined estimate for them.
+    VCTR_TARGET ("avx512f") static AVX512Register fastSqrt (AVX512Register x)       { return { computeFastSqrt (x.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fastRsqrt (AVX512Register x)      { return { computeFastRsqrt (x.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fastReciprocal (AVX512Register x) { return { computeFastReciprocal (x.value) }; }
+
+    //==============================================================================
+    // Trigonometric Functions
+    // The same polynomial approximations and argument reduction as in AVXRegister<float>, so the max. error is 3 ulp
+    // for sin and cos and 4 ulp for tan. Lanes with arguments above 8192 and inf are computed with the std functions.
+    VCTR_TARGET ("avx512f") static AVX512Register sin (AVX512Register x) { return { computeSin (x.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register cos (AVX512Register x) { return { computeCos (x.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register tan (AVX512Register x) { return { computeTan (x.value) }; }
+
+    /** Returns the sine and the cosine of x, sharing the argument reduction between both. */
+    VCTR_ALWAYSINLINE VCTR_TARGET ("avx512f") static std::pair<AVX512Register, AVX512Register> sinCos (AVX512Register x)
+    {
+        __m512 s, c;
+        computeSinCos (x.value, s, c);
+        return { { s }, { c } };
+    }
+
+private:
+    // The public functions above only wrap these kernels, which work on the native type. GCC clears the upper lanes of an
+    // AVX512Register returned by a function that is not inlined, unless the whole translation unit is compiled with
+    // AVX-512 enabled. One line wrappers are always inlined, a native __m512 return value is not affected.
+    VCTR_TARGET ("avx512f") static __m512 computeFastSqrt (__m512 x)
+    {
+        const auto isNormal = isNormalNumber (x);
+        const auto y = _mm512_mul_ps (x, refineRsqrt (x, _mm512_rsqrt14_ps (x)));
+
+        // Clearing the mantissa bits flushes subnormal arguments to zero and keeps zero and inf. Negative and NaN
+        // arguments are turned into NaN
+        const auto special = _mm512_castsi512_ps (_mm512_and_si512 (_mm512_castps_si512 (x), _mm512_set1_epi32 (int32_t (0xff800000))));
+        const auto result = _mm512_mask_blend_ps (isNormal, special, y);
+        return _mm512_mask_blend_ps (_mm512_cmp_ps_mask (x, _mm512_setzero_ps(), _CMP_NGE_UQ), result, _mm512_set1_ps (std::numeric_limits<float>::quiet_NaN()));
+    }
+
+    VCTR_TARGET ("avx512f") static __m512 computeFastRsqrt (__m512 x)
+    {
+        // Unlike rsqrt14, the SSE and AVX estimates treat subnormal arguments as zero. Keeping only the sign bit of
+        // subnormal arguments does the same here, so that they return inf
+        const auto isSubnormal = _mm512_cmp_ps_mask (_mm512_abs_ps (x), _mm512_set1_ps (std::numeric_limits<float>::min()), _CMP_LT_OQ);
+        const auto signBit = _mm512_castsi512_ps (_mm512_and_si512 (_mm512_castps_si512 (x), _mm512_set1_epi32 (int32_t (0x80000000))));
+        const auto estimate = _mm512_rsqrt14_ps (_mm512_mask_blend_ps (isSubnormal, x, signBit));
+        return _mm512_mask_blend_ps (isNormalNumber (x), estimate, refineRsqrt (x, estimate));
+    }
+
+    VCTR_TARGET ("avx512f") static __m512 computeFastReciprocal (__m512 x)
+    {
+        const auto estimate = _mm512_rcp14_ps (x);
+
+        // y * (2 - x * y)
+        const auto y = _mm512_mul_ps (estimate, _mm512_sub_ps (_mm512_set1_ps (2.0f), _mm512_mul_ps (x, estimate)));
+        return _mm512_mask_blend_ps (isNormalNumber (x), estimate, y);
+    }
+
+    /** Returns a mask of all lanes holding a finite value with a magnitude not below the smallest normal float. */
+    VCTR_TARGET ("avx512f") static __mmask16 isNormalNumber (__m512 x)
+    {
+        const auto magnitude = _mm512_abs_ps (x);
+        return _mm512_cmp_ps_mask (magnitude, _mm512_set1_ps (std::numeric_limits<float>::min()), _CMP_GE_OQ) & _mm512_cmp_ps_mask (magnitude, _mm512_set1_ps (std::numeric_limits<float>::max()), _CMP_LE_OQ);
+    }
+
+    /** Refines the estimate y of 1 / sqrt (x) by one Newton-Raphson step, y * (1.5 - 0.5 * x * y^2). */
+    VCTR_TARGET ("avx512f") static __m512 refineRsqrt (__m512 x, __m512 y)
+    {
+        const auto halfXTimesYSquared = _mm512_mul_ps (_mm512_mul_ps (_mm512_mul_ps (x, _mm512_set1_ps (0.5f)), y), y);
+        return _mm512_mul_ps (y, _mm512_sub_ps (_mm512_set1_ps (1.5f), halfXTimesYSquared));
+    }
+
+    /** Splits x into n * pi / 2 + r with r in [-pi / 4, pi / 4], returns the quadrant n and writes r. pi / 2 is split into
+        four parts, the products of the first three are exact.
+     */
+    VCTR_TARGET ("avx512f") static __m512i reduceToQuadrant (__m512 x, __m512& r)
+    {
+        const auto n = _mm512_roundscale_ps (_mm512_mul_ps (x, _mm512_set1_ps (0.636619772367581343f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        r = _mm512_sub_ps (x, _mm512_mul_ps (n, _mm512_set1_ps (1.5703125f)));
+        r = _mm512_sub_ps (r, _mm512_mul_ps (n, _mm512_set1_ps (4.837512969970703125e-4f)));
+        r = _mm512_sub_ps (r, _mm512_mul_ps (n, _mm512_set1_ps (7.549533620476723e-8f)));
+        r = _mm512_sub_ps (r, _mm512_mul_ps (n, _mm512_set1_ps (2.5633440682570896e-12f)));
+
+        return _mm512_cvtps_epi32 (n);
+    }
+
+    /** Computes the sine and the cosine of x, large arguments are computed with the std functions. */
+    VCTR_TARGET ("avx512f") static void computeSinCos (__m512 x, __m512& sinResult, __m512& cosResult)
+    {
+        __m512 r;
+        const auto n = reduceToQuadrant (x, r);
+        const auto z = _mm512_mul_ps (r, r);
+
+        auto s = _mm512_set1_ps (-1.9515295891e-4f);
+        s = _mm512_add_ps (_mm512_mul_ps (s, z), _mm512_set1_ps (8.3321608736e-3f));
+        s = _mm512_add_ps (_mm512_mul_ps (s, z), _mm512_set1_ps (-1.6666654611e-1f));
+        s = _mm512_add_ps (_mm512_mul_ps (_mm512_mul_ps (s, z), r), r);
+
+        auto c = _mm512_set1_ps (2.443315711809948e-5f);
+        c = _mm512_add_ps (_mm512_mul_ps (c, z), _mm512_set1_ps (-1.388731625493765e-3f));
+        c = _mm512_add_ps (_mm512_mul_ps (c, z), _mm512_set1_ps (4.166664568298827e-2f));
+        c = _mm512_add_ps (_mm512_sub_ps (_mm512_mul_ps (_mm512_mul_ps (c, z), z), _mm512_mul_ps (z, _mm512_set1_ps (0.5f))), _mm512_set1_ps (1.0f));
+
+        // In odd quadrants sin and cos swap roles. sin is negative in quadrants 2 and 3, cos in quadrants 1 and 2, so
+        // bit 1 of n and n + 1 is shifted into the sign bit
+        const auto isOddQuadrant = _mm512_test_epi32_mask (n, _mm512_set1_epi32 (1));
+        const auto sinSign = _mm512_slli_epi32 (_mm512_and_si512 (n, _mm512_set1_epi32 (2)), 30);
+        const auto cosSign = _mm512_slli_epi32 (_mm512_and_si512 (_mm512_add_epi32 (n, _mm512_set1_epi32 (1)), _mm512_set1_epi32 (2)), 30);
+
+        const auto sinValue = _mm512_castsi512_ps (_mm512_xor_si512 (_mm512_castps_si512 (_mm512_mask_blend_ps (isOddQuadrant, s, c)), sinSign));
+        const auto cosValue = _mm512_castsi512_ps (_mm512_xor_si512 (_mm512_castps_si512 (_mm512_mask_blend_ps (isOddQuadrant, c, s)), cosSign));
+
+        sinResult = computeLargeArgumentsWithStd (x, sinValue, [] (float v) { return std::sin (v); });
+        cosResult = computeLargeArgumentsWithStd (x, cosValue, [] (float v) { return std::cos (v); });
+    }
+
+    VCTR_TARGET ("avx512f") static __m512 computeSin (__m512 x)
+    {
+        __m512 s, c;
+        computeSinCos (x, s, c);
+        return s;
+    }
+
+    VCTR_TARGET ("avx512f") static __m512 computeCos (__m512 x)
+    {
+        __m512 s, c;
+        computeSinCos (x, s, c);
+        return c;
+    }
+
+    VCTR_TARGET ("avx512f") static __m512 computeTan (__m512 x)
+    {
+        __m512 r;
+        const auto n = reduceToQuadrant (x, r);
+
+        const auto z = _mm512_mul_ps (r, r);
+        auto p = _mm512_set1_ps (9.38540185543e-3f);
+        p = _mm512_add_ps (_mm512_mul_ps (p, z), _mm512_set1_ps (3.11992232697e-3f));
+        p = _mm512_add_ps (_mm512_mul_ps (p, z), _mm512_set1_ps (2.44301354525e-2f));
+        p = _mm512_add_ps (_mm512_mul_ps (p, z), _mm512_set1_ps (5.34112807005e-2f));
+        p = _mm512_add_ps (_mm512_mul_ps (p, z), _mm512_set1_ps (1.33387994085e-1f));
+        p = _mm512_add_ps (_mm512_mul_ps (p, z), _mm512_set1_ps (3.33331568548e-1f));
+        const auto t = _mm512_add_ps (_mm512_mul_ps (_mm512_mul_ps (p, z), r), r);
+
+        // tan (x) = -1 / tan (r) in odd quadrants
+        const auto y = _mm512_mask_div_ps (t, _mm512_test_epi32_mask (n, _mm512_set1_epi32 (1)), _mm512_set1_ps (-1.0f), t);
+
+        return computeLargeArgumentsWithStd (x, y, [] (float v) { return std::tan (v); });
+    }
+
+    /** Replaces the lanes of y with the result of stdFn for all lanes where the absolute value of x is too large for reduceToQuadrant or inf. */
+    template <class StdFn>
+    VCTR_TARGET ("avx512f") static __m512 computeLargeArgumentsWithStd (__m512 x, __m512 y, StdFn&& stdFn)
+    {
+        const auto isLarge = _mm512_cmp_ps_mask (_mm512_abs_ps (x), _mm512_set1_ps (8192.0f), _CMP_GT_OQ);
+
+        if (isLarge == 0)
+            return y;
+
+        alignas (64) float xs[numElements], ys[numElements];
+        _mm512_store_ps (xs, x);
+        _mm512_store_ps (ys, y);
+
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            if (isLarge & (1 << i))
+                ys[i] = stdFn (xs[i]);
+        }
+
+        return _mm512_load_ps (ys);
+    }
+};
+
+template <>
+struct AVX512Register<double>
+{
+    static constexpr size_t numElements = 8;
+
+    using NativeType = __m512d;
+    __m512d value;
+
+    //==============================================================================
+    // Loading
+    // clang-format off
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnaligned (const double* d)                              { return { _mm512_loadu_pd (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register loadAligned   (const double* d)                              { return { _mm512_load_pd (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register broadcast     (double x)                                     { return { _mm512_set1_pd (x) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fromAVX       (AVXRegister<double> a, AVXRegister<double> b) { return { _mm512_insertf64x4 (_mm512_castpd256_pd512 (b.value), a.value, 1) }; }
+
+    // Loads the elements selected by mask and takes all others from fill. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnalignedMasked (const double* d, __mmask8 mask, AVX512Register fill) { return { _mm512_mask_loadu_pd (fill.value, mask, d) }; }
+
+    //==============================================================================
+    // Storing
+    VCTR_TARGET ("avx512f") void storeUnaligned (double* d) const { _mm512_storeu_pd (d, value); }
+    VCTR_TARGET ("avx512f") void storeAligned   (double* d) const { _mm512_store_pd  (d, value); }
+
+    // Stores the elements selected by mask to consecutive addresses
+    VCTR_TARGET ("avx512f") void storeCompressed (double* d, __mmask8 mask) const { _mm512_mask_compressstoreu_pd (d, mask, value); }
+
+    // Stores the elements selected by mask. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx512f") void storeUnalignedMasked (double* d, __mmask8 mask) const { _mm512_mask_storeu_pd (d, mask, value); }
+
+    //==============================================================================
+    // Bit Operations
+    VCTR_TARGET ("avx512f") static AVX512Register andNot (AVX512Register a, AVX512Register b) { return { _mm512_castsi512_pd (_mm512_andnot_si512 (_mm512_castpd_si512 (a.value), _mm512_castpd_si512 (b.value))) }; }
+
+    //==============================================================================
+    // Comparison and Selection, lanes compared against NaN are always false
+    VCTR_TARGET ("avx512f") static __mmask8       greaterThan (AVX512Register a, AVX512Register b)                    { return _mm512_cmp_pd_mask (a.value, b.value, _CMP_GT_OQ); }
+    VCTR_TARGET ("avx512f") static __mmask8       lessThan    (AVX512Register a, AVX512Register b)                    { return _mm512_cmp_pd_mask (a.value, b.value, _CMP_LT_OQ); }
+    VCTR_TARGET ("avx512f") static AVX512Register select      (__mmask8 mask, AVX512Register a, AVX512Register b) { return { _mm512_mask_blend_pd (mask, b.value, a.value) }; }
+
+    //==============================================================================
+    // Element Shifting, used by prefix scans. shiftUp moves all elements n lanes up and fills the lowest lanes with the
+    // highest lanes of fill, which is expected to hold the same value in all lanes.
+    template <int n>
+    VCTR_TARGET ("avx512f") static AVX512Register shiftUp       (AVX512Register x, AVX512Register fill) { return { _mm512_castsi512_pd (_mm512_alignr_epi64 (_mm512_castpd_si512 (x.value), _mm512_castpd_si512 (fill.value), 8 - n)) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register broadcastLast (AVX512Register x)                      { return { _mm512_permutexvar_pd (_mm512_set1_epi64 (7), x.value) }; }
+
+    //==============================================================================
+    // Element Permutation, used by sorting networks. swapAdjacentGroups exchanges each group of n adjacent elements
+    // with its neighbouring group, so that element i ends up at index i ^ n.
+    template <int n>
+    VCTR_TARGET ("avx512f") static AVX512Register swapAdjacentGroups (AVX512Register x) { return { n == 1 ? _mm512_permute_pd (x.value, 0x55) : n == 2 ? _mm512_shuffle_f64x2 (x.value, x.value, 0xB1) : _mm512_shuffle_f64x2 (x.value, x.value, 0x4E) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register reverse            (AVX512Register x) { return { _mm512_permutexvar_pd (_mm512_set_epi64 (0, 1, 2, 3, 4, 5, 6, 7), x.value) }; }
+
+    //==============================================================================
+    // Math
+    VCTR_TARGET ("avx512f") static AVX512Register mul (AVX512Register a, AVX512Register b) { return { _mm512_mul_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register add (AVX512Register a, AVX512Register b) { return { _mm512_add_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register sub (AVX512Register a, AVX512Register b) { return { _mm512_sub_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register div (AVX512Register a, AVX512Register b) { return { _mm512_div_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register max (AVX512Register a, AVX512Register b) { return { _mm512_max_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register min (AVX512Register a, AVX512Register b) { return { _mm512_min_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register sqrt (AVX512Register x)                 { return { _mm512_sqrt_pd (x.value) }; }
+
+    //==============================================================================
+    // Fused Multiply Add, always available with AVX-512F
+    VCTR_TARGET ("avx512f") static AVX512Register fma  (AVX512Register a, AVX512Register b, AVX512Register c) { return { _mm512_fmadd_pd (a.value, b.value, c.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fms  (AVX512Register a, AVX512Register b, AVX512Register c) { return { _mm512_fmsub_pd (a.value, b.value, c.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fnma (AVX512Register a, AVX512Register b, AVX512Register c) { return { _mm512_fnmadd_pd (a.value, b.value, c.value) }; }
+    // clang-format on
+
+    //==============================================================================
+    // Trigonometric Functions
+    // The same polynomial approximations and argument reduction as in AVXRegister<double>, so the max. error is 3 ulp
+    // for sin and cos and 4 ulp for tan. Lanes with arguments above 2^30 and inf are computed with the std functions.
+    VCTR_TARGET ("avx512f") static AVX512Register sin (AVX512Register x) { return { computeSin (x.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register cos (AVX512Register x) { return { computeCos (x.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register tan (AVX512Register x) { return { computeTan (x.value) }; }
+
+    /** Returns the sine and the cosine of x, sharing the argument reduction between both. */
+    VCTR_ALWAYSINLINE VCTR_TARGET ("avx512f") static std::pair<AVX512Register, AVX512Register> sinCos (AVX512Register x)
+    {
+        __m512d s, c;
+        computeSinCos (x.value, s, c);
+        return { { s }, { c } };
+    }
+
+private:
+    // Kernels on the native type wrapped by the public functions above, see AVX512Register<float> for the reason
+
+    /** Splits x into n * pi / 2 + r with r in [-pi / 4, pi / 4], returns the quadrant n and writes r. pi / 2 is split into
+        four parts, the products of the first three are exact.
+     */
+    VCTR_TARGET ("avx512f") static __m512i reduceToQuadrant (__m512d x, __m512d& r)
+    {
+        const auto n = _mm512_roundscale_pd (_mm512_mul_pd (x, _mm512_set1_pd (0.63661977236758134308)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        r = _mm512_sub_pd (x, _mm512_mul_pd (n, _mm512_set1_pd (1.570796251296997)));
+        r = _mm512_sub_pd (r, _mm512_mul_pd (n, _mm512_set1_pd (7.549789415861596e-8)));
+        r = _mm512_sub_pd (r, _mm512_mul_pd (n, _mm512_set1_pd (5.390302529957765e-15)));
+        r = _mm512_sub_pd (r, _mm512_mul_pd (n, _mm512_set1_pd (3.2820035428735005e-22)));
+
+        // n fits into 32 bit for all arguments that are not computed with the std functions
+        return _mm512_cvtepi32_epi64 (_mm512_cvtpd_epi32 (n));
+    }
+
+    /** Computes the sine and the cosine of x, large arguments are computed with the std functions. */
+    VCTR_TARGET ("avx512f") static void computeSinCos (__m512d x, __m512d& sinResult, __m512d& cosResult)
+    {
+        __m512d r;
+        const auto n = reduceToQuadrant (x, r);
+        const auto z = _mm512_mul_pd (r, r);
+
+        auto s = _mm512_set1_pd (1.58962301576546568060e-10);
+        s = _mm512_add_pd (_mm512_mul_pd (s, z), _mm512_set1_pd (-2.50507477628578072866e-8));
+        s = _mm512_add_pd (_mm512_mul_pd (s, z), _mm512_set1_pd (2.75573136213857245213e-6));
+        s = _mm512_add_pd (_mm512_mul_pd (s, z), _mm512_set1_pd (-1.98412698295895385996e-4));
+        s = _mm512_add_pd (_mm512_mul_pd (s, z), _mm512_set1_pd (8.33333333332211858878e-3));
+        s = _mm512_add_pd (_mm512_mul_pd (s, z), _mm512_set1_pd (-1.66666666666666307295e-1));
+        s = _mm512_add_pd (_mm512_mul_pd (_mm512_mul_pd (s, z), r), r);
+
+        auto c = _mm512_set1_pd (-1.13585365213876817300e-11);
+        c = _mm512_add_pd (_mm512_mul_pd (c, z), _mm512_set1_pd (2.08757008419747316778e-9));
+        c = _mm512_add_pd (_mm512_mul_pd (c, z), _mm512_set1_pd (-2.75573141792967388112e-7));
+        c = _mm512_add_pd (_mm512_mul_pd (c, z), _mm512_set1_pd (2.48015872888517045348e-5));
+        c = _mm512_add_pd (_mm512_mul_pd (c, z), _mm512_set1_pd (-1.38888888888730564116e-3));
+        c = _mm512_add_pd (_mm512_mul_pd (c, z), _mm512_set1_pd (4.16666666666665929218e-2));
+        c = _mm512_add_pd (_mm512_sub_pd (_mm512_mul_pd (_mm512_mul_pd (c, z), z), _mm512_mul_pd (z, _mm512_set1_pd (0.5))), _mm512_set1_pd (1.0));
+
+        // In odd quadrants sin and cos swap roles. sin is negative in quadrants 2 and 3, cos in quadrants 1 and 2, so
+        // bit 1 of n and n + 1 is shifted into the sign bit
+        const auto isOddQuadrant = _mm512_test_epi64_mask (n, _mm512_set1_epi64 (1));
+        const auto sinSign = _mm512_slli_epi64 (_mm512_and_si512 (n, _mm512_set1_epi64 (2)), 62);
+        const auto cosSign = _mm512_slli_epi64 (_mm512_and_si512 (_mm512_add_epi64 (n, _mm512_set1_epi64 (1)), _mm512_set1_epi64 (2)), 62);
+
+        const auto sinValue = _mm512_castsi512_pd (_mm512_xor_si512 (_mm512_castpd_si512 (_mm512_mask_blend_pd (isOddQuadrant, s, c)), sinSign));
+        const auto cosValue = _mm512_castsi512_pd (_mm512_xor_si512 (_mm512_castpd_si512 (_mm512_mask_blend_pd (isOddQuadrant, c, s)), cosSign));
+
+        sinResult = computeLargeArgumentsWithStd (x, sinValue, [] (double v) { return std::sin (v); });
+        cosResult = computeLargeArgumentsWithStd (x, cosValue, [] (double v) { return std::cos (v); });
+    }
+
+    VCTR_TARGET ("avx512f") static __m512d computeSin (__m512d x)
+    {
+        __m512d s, c;
+        computeSinCos (x, s, c);
+        return s;
+    }
+
+    VCTR_TARGET ("avx512f") static __m512d computeCos (__m512d x)
+    {
+        __m512d s, c;
+        computeSinCos (x, s, c);
+        return c;
+    }
+
+    VCTR_TARGET ("avx512f") static __m512d computeTan (__m512d x)
+    {
+        __m512d r;
+        const auto n = reduceToQuadrant (x, r);
+
+        // Rational approximation tan (r) = r + r * z * P (z) / Q (z) with z = r^2
+        const auto z = _mm512_mul_pd (r, r);
+        auto p = _mm512_set1_pd (-1.30936939181383777646e4);
+        p = _mm512_add_pd (_mm512_mul_pd (p, z), _mm512_set1_pd (1.15351664838587416140e6));
+        p = _mm512_add_pd (_mm512_mul_pd (p, z), _mm512_set1_pd (-1.79565251976484877988e7));
+
+        auto q = _mm512_add_pd (z, _mm512_set1_pd (1.36812963470692954678e4));
+        q = _mm512_add_pd (_mm512_mul_pd (q, z), _mm512_set1_pd (-1.32089234440210967447e6));
+        q = _mm512_add_pd (_mm512_mul_pd (q, z), _mm512_set1_pd (2.50083801823357915839e7));
+        q = _mm512_add_pd (_mm512_mul_pd (q, z), _mm512_set1_pd (-5.38695755929454629881e7));
+
+        const auto t = _mm512_add_pd (_mm512_mul_pd (r, _mm512_div_pd (_mm512_mul_pd (z, p), q)), r);
+
+        // tan (x) = -1 / tan (r) in odd quadrants
+        const auto y = _mm512_mask_div_pd (t, _mm512_test_epi64_mask (n, _mm512_set1_epi64 (1)), _mm512_set1_pd (-1.0), t);
+
+        return computeLargeArgumentsWithStd (x, y, [] (double v) { return std::tan (v); });
+    }
+
+    /** Replaces the lanes of y with the result of stdFn for all lanes where the absolute value of x is too large for reduceToQuadrant or inf. */
+    template <class StdFn>
+    VCTR_TARGET ("avx512f") static __m512d computeLargeArgumentsWithStd (__m512d x, __m512d y, StdFn&& stdFn)
+    {
+        const auto isLarge = _mm512_cmp_pd_mask (_mm512_abs_pd (x), _mm512_set1_pd (1073741824.0), _CMP_GT_OQ);
+
+        if (isLarge == 0)
+            return y;
+
+        alignas (64) double xs[numElements], ys[numElements];
+        _mm512_store_pd (xs, x);
+        _mm512_store_pd (ys, y);
+
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            if (isLarge & (1 << i))
+                ys[i] = stdFn (xs[i]);
+        }
+
+        return _mm512_load_pd (ys);
+    }
+};
+
+template <>
+struct AVX512Register<int32_t>
+{
+    static constexpr size_t numElements = 16;
+
+    using NativeType = __m512i;
+    __m512i value;
+
+    //==============================================================================
+    // Loading
+    // clang-format off
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnaligned (const int32_t* d)                               { return { _mm512_loadu_si512 (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register loadAligned   (const int32_t* d)                               { return { _mm512_load_si512 (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register broadcast     (int32_t x)                                      { return { _mm512_set1_epi32 (x) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fromAVX       (AVXRegister<int32_t> a, AVXRegister<int32_t> b) { return { _mm512_inserti64x4 (_mm512_castsi256_si512 (b.value), a.value, 1) }; }
+
+    // Loads the elements selected by mask and takes all others from fill. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnalignedMasked (const int32_t* d, __mmask16 mask, AVX512Register fill) { return { _mm512_mask_loadu_epi32 (fill.value, mask, d) }; }
+
+    //==============================================================================
+    // Storing
+    VCTR_TARGET ("avx512f") void storeUnaligned (int32_t* d) const { _mm512_storeu_si512 (d, value); }
+    VCTR_TARGET ("avx512f") void storeAligned   (int32_t* d) const { _mm512_store_si512  (d, value); }
+
+    // Stores the elements selected by mask to consecutive addresses
+    VCTR_TARGET ("avx512f") void storeCompressed (int32_t* d, __mmask16 mask) const { _mm512_mask_compressstoreu_epi32 (d, mask, value); }
+
+    // Stores the elements selected by mask. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx512f") void storeUnalignedMasked (int32_t* d, __mmask16 mask) const { _mm512_mask_storeu_epi32 (d, mask, value); }
+
+    //==============================================================================
+    // Bit Operations
+
+    //==============================================================================
+    // Comparison and Selection
+    VCTR_TARGET ("avx512f") static __mmask16      greaterThan (AVX512Register a, AVX512Register b)                    { return _mm512_cmp_epi32_mask (a.value, b.value, _MM_CMPINT_NLE); }
+    VCTR_TARGET ("avx512f") static __mmask16      lessThan    (AVX512Register a, AVX512Register b)                    { return _mm512_cmp_epi32_mask (a.value, b.value, _MM_CMPINT_LT); }
+    VCTR_TARGET ("avx512f") static AVX512Register select      (__mmask16 mask, AVX512Register a, AVX512Register b) { return { _mm512_mask_blend_epi32 (mask, b.value, a.value) }; }
+
+    //==============================================================================
+    // Element Permutation, used by sorting networks. swapAdjacentGroups exchanges each group of n adjacent elements
+    // with its neighbouring group, so that element i ends up at index i ^ n.
+    template <int n>
+    VCTR_TARGET ("avx512f") static AVX512Register swapAdjacentGroups (AVX512Register x) { return { n == 1 ? _mm512_shuffle_epi32 (x.value, _MM_PERM_CDAB) : n == 2 ? _mm512_shuffle_epi32 (x.value, _MM_PERM_BADC) : n == 4 ? _mm512_shuffle_i32x4 (x.value, x.value, 0xB1) : _mm512_shuffle_i32x4 (x.value, x.value, 0x4E) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register reverse            (AVX512Register x) { return { _mm512_permutexvar_epi32 (_mm512_set_epi32 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), x.value) }; }
+
+    //==============================================================================
+    // Math
+    VCTR_TARGET ("avx512f") static AVX512Register abs (AVX512Register x)                   { return { _mm512_abs_epi32 (x.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register add (AVX512Register a, AVX512Register b) { return { _mm512_add_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register sub (AVX512Register a, AVX512Register b) { return { _mm512_sub_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register max (AVX512Register a, AVX512Register b) { return { _mm512_max_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register min (AVX512Register a, AVX512Register b) { return { _mm512_min_epi32 (a.value, b.value) }; }
+    // clang-format on
+};
+
+template <>
+struct AVX512Register<uint32_t>
+{
+    static constexpr size_t numElements = 16;
+
+    using NativeType = __m512i;
+    __m512i value;
+
+    //==============================================================================
+    // Loading
+    // clang-format off
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnaligned (const uint32_t* d)                                { return { _mm512_loadu_si512 (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register loadAligned   (const uint32_t* d)                                { return { _mm512_load_si512 (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register broadcast     (uint32_t x)                                       { return { _mm512_set1_epi32 ((int32_t) x) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fromAVX       (AVXRegister<uint32_t> a, AVXRegister<uint32_t> b) { return { _mm512_inserti64x4 (_mm512_castsi256_si512 (b.value), a.value, 1) }; }
+
+    // Loads the elements selected by mask and takes all others from fill. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnalignedMasked (const uint32_t* d, __mmask16 mask, AVX512Register fill) { return { _mm512_mask_loadu_epi32 (fill.value, mask, d) }; }
+
+    //==============================================================================
+    // Storing
+    VCTR_TARGET ("avx512f") void storeUnaligned (uint32_t* d) const { _mm512_storeu_si512 (d, value); }
+    VCTR_TARGET ("avx512f") void storeAligned   (uint32_t* d) const { _mm512_store_si512  (d, value); }
+
+    // Stores the elements selected by mask to consecutive addresses
+    VCTR_TARGET ("avx512f") void storeCompressed (uint32_t* d, __mmask16 mask) const { _mm512_mask_compressstoreu_epi32 (d, mask, value); }
+
+    // Stores the elements selected by mask. Memory of unselected elements is not accessed.
+    VCTR_TARGET ("avx512f") void storeUnalignedMasked (uint32_t* d, __mmask16 mask) const { _mm512_mask_storeu_epi32 (d, mask, value); }
+
+    //==============================================================================
+    // Bit Operations
+
+    //==============================================================================
+    // Comparison and Selection
+    VCTR_TARGET ("avx512f") static __mmask16      greaterThan (AVX512Register a, AVX512Register b)                    { return _mm512_cmp_epu32_mask (a.value, b.value, _MM_CMPINT_NLE); }
+    VCTR_TARGET ("avx512f") static __mmask16      lessThan    (AVX512Register a, AVX512Register b)                    { return _mm512_cmp_epu32_mask (a.value, b.value, _MM_CMPINT_LT); }
+    VCTR_TARGET ("avx512f") static AVX512Register select      (__mmask16 mask, AVX512Register a, AVX512Register b) { return { _mm512_mask_blend_epi32 (mask, b.value, a.value) }; }
+
+    //==============================================================================
+    // Element Permutation, used by sorting networks. swapAdjacentGroups exchanges each group of n adjacent elements
+    // with its neighbouring group, so that element i ends up at index i ^ n.
+    template <int n>
+    VCTR_TARGET ("avx512f") static AVX512Register swapAdjacentGroups (AVX512Register x) { return { n == 1 ? _mm512_shuffle_epi32 (x.value, _MM_PERM_CDAB) : n == 2 ? _mm512_shuffle_epi32 (x.value, _MM_PERM_BADC) : n == 4 ? _mm512_shuffle_i32x4 (x.value, x.value, 0xB1) : _mm512_shuffle_i32x4 (x.value, x.value, 0x4E) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register reverse            (AVX512Register x) { return { _mm512_permutexvar_epi32 (_mm512_set_epi32 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), x.value) }; }
+
+    //==============================================================================
+    // Math
+    VCTR_TARGET ("avx512f") static AVX512Register add (AVX512Register a, AVX512Register b) { return { _mm512_add_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register sub (AVX512Register a, AVX512Register b) { return { _mm512_sub_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register max (AVX512Register a, AVX512Register b) { return { _mm512_max_epu32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register min (AVX512Register a, AVX512Register b) { return { _mm512_min_epu32 (a.value, b.value) }; }
+    // clang-format on
+};
+
+template <>
+struct AVX512Register<int64_t>
+{
+    static constexpr size_t numElements = 8;
+
+    using NativeType = __m512i;
+    __m512i value;
+
+    //==============================================================================
+    // Loading
+    // clang-format off
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnaligned (const int64_t* d)                               { return { _mm512_loadu_si512 (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register loadAligned   (const int64_t* d)                               { return { _mm512_load_si512 (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register broadcast     (int64_t x)                                      { return { _mm512_set1_epi64 (x) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fromAVX       (AVXRegister<int64_t> a, AVXRegister<int64_t> b) { return { _mm512_inserti64x4 (_mm512_castsi256_si512 (b.value), a.value, 1) }; }
+
+    //==============================================================================
+    // Storing
+    VCTR_TARGET ("avx512f") void storeUnaligned (int64_t* d) const { _mm512_storeu_si512 (d, value); }
+    VCTR_TARGET ("avx512f") void storeAligned   (int64_t* d) const { _mm512_store_si512  (d, value); }
+
+    //==============================================================================
+    // Bit Operations
+
+    //==============================================================================
+    // Math
+    VCTR_TARGET ("avx512f") static AVX512Register abs (AVX512Register x)                   { return { _mm512_abs_epi64 (x.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register add (AVX512Register a, AVX512Register b) { return { _mm512_add_epi64 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register sub (AVX512Register a, AVX512Register b) { return { _mm512_sub_epi64 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register max (AVX512Register a, AVX512Register b) { return { _mm512_max_epi64 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register min (AVX512Register a, AVX512Register b) { return { _mm512_min_epi64 (a.value, b.value) }; }
+    // clang-format on
+};
+
+template <>
+struct AVX512Register<uint64_t>
+{
+    static constexpr size_t numElements = 8;
+
+    using NativeType = __m512i;
+    __m512i value;
+
+    //==============================================================================
+    // Loading
+    // clang-format off
+    VCTR_TARGET ("avx512f") static AVX512Register loadUnaligned (const uint64_t* d)                                { return { _mm512_loadu_si512 (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register loadAligned   (const uint64_t* d)                                { return { _mm512_load_si512 (d) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register broadcast     (uint64_t x)                                       { return { _mm512_set1_epi64 ((int64_t) x) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register fromAVX       (AVXRegister<uint64_t> a, AVXRegister<uint64_t> b) { return { _mm512_inserti64x4 (_mm512_castsi256_si512 (b.value), a.value, 1) }; }
+
+    //==============================================================================
+    // Storing
+    VCTR_TARGET ("avx512f") void storeUnaligned (uint64_t* d) const { _mm512_storeu_si512 (d, value); }
+    VCTR_TARGET ("avx512f") void storeAligned   (uint64_t* d) const { _mm512_store_si512  (d, value); }
+
+    //==============================================================================
+    // Bit Operations
+
+    //==============================================================================
+    // Math
+    VCTR_TARGET ("avx512f") static AVX512Register add (AVX512Register a, AVX512Register b) { return { _mm512_add_epi64 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register sub (AVX512Register a, AVX512Register b) { return { _mm512_sub_epi64 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register max (AVX512Register a, AVX512Register b) { return { _mm512_max_epu64 (a.value, b.value) }; }
+    VCTR_TARGET ("avx512f") static AVX512Register min (AVX512Register a, AVX512Register b) { return { _mm512_min_epu64 (a.value, b.value) }; }
+    // clang-format on
+};
+
+#endif
+
+} // namespace vctr
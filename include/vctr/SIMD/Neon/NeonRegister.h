@@ -53,6 +53,13 @@ struct NeonRegister<float>
     // Bit Operations
     static NeonRegister andNot (NeonRegister a, NeonRegister b) { return { vreinterpretq_f32_u32 (vandq_u32 (vreinterpretq_u32_f32 (a.value), vreinterpretq_u32_f32 (b.value))) }; }
 
+    //==============================================================================
+    // Element Shifting, used by prefix scans. shiftUp moves all elements n lanes up and fills the lowest lanes with the
+    // highest lanes of fill, which is expected to hold the same value in all lanes.
+    template <int n>
+    static NeonRegister shiftUp       (NeonRegister x, NeonRegister fill) { return { vextq_f32 (fill.value, x.value, 4 - n) }; }
+    static NeonRegister broadcastLast (NeonRegister x)                    { return { vdupq_laneq_f32 (x.value, 3) }; }
+
     //==============================================================================
     // Math
     static NeonRegister abs (NeonRegister x)                 { return { vabsq_f32 (x.value) }; }
@@ -86,6 +93,13 @@ struct NeonRegister<double>
     // Bit Operations
     static NeonRegister andNot (NeonRegister a, NeonRegister b) { return { vreinterpretq_f64_u64 (vandq_u64 (vreinterpretq_u64_f64 (a.value), vreinterpretq_u64_f64 (b.value))) }; }
 
+    //==============================================================================
+    // Element Shifting, used by prefix scans. shiftUp moves all elements n lanes up and fills the lowest lanes with the
+    // highest lanes of fill, which is expected to hold the same value in all lanes.
+    template <int n>
+    static NeonRegister shiftUp       (NeonRegister x, NeonRegister fill) { return { vextq_f64 (fill.value, x.value, 2 - n) }; }
+    static NeonRegister broadcastLast (NeonRegister x)                    { return { vdupq_laneq_f64 (x.value, 1) }; }
+
     //==============================================================================
     // Math
     static NeonRegister abs (NeonRegister x)                 { return { vabsq_f64 (x.value) }; }
@@ -40,6 +40,25 @@ constexpr size_t nextMultipleOf (size_t numElements)
     return size_t ((int64_t (numElements) + int64_t (value) - 1) & -int64_t (value));
 }
 
+/** Returns the number of elements between ptr and the next address aligned to alignment bytes. Returns 0 if ptr is
+    already aligned or if it cannot be aligned by advancing it by whole elements.
+ */
+template <size_t alignment, class T>
+requires (is::powerOfTwoInt<alignment>)
+size_t numElementsUntilAligned (const T* ptr)
+{
+    const auto offset = reinterpret_cast<std::uintptr_t> (ptr) & (alignment - 1);
+    return offset % sizeof (T) == 0 ? ((alignment - offset) & (alignment - 1)) / sizeof (T) : 0;
+}
+
+/** Returns true if ptr is aligned to alignment bytes. */
+template <size_t alignment, class T>
+requires (is::powerOfTwoInt<alignment>)
+bool isAligned (const T* ptr)
+{
+    return (reinterpret_cast<std::uintptr_t> (ptr) & (alignment - 1)) == 0;
+}
+
 } // namespace vctr::detail
 
 namespace vctr
@@ -73,8 +92,8 @@ inline constexpr bool isPtrAligned (const void* ptr)
     - hasSIMDExtendedStorage: Specifies if the actually allocated memory is extended with unused dummy values at the end
                               in a way that it is a multiple of the size of an AVX register (x64) or Neon register (ARM).
 
-    There are template specialisations for std::vector with an AlignedAllocator and std::array, which define all
-    variable as static constexpr in order to make this struct as lightweight as possible in most cases.
+    There are template specialisations for std::vector with an AlignedAllocator or a NumaLocalAllocator and std::array,
+    which define all variable as static constexpr in order to make this struct as lightweight as possible in most cases.
 
  */
 
@@ -126,6 +145,19 @@ struct StorageInfo<std::vector<ElementType, AlignedAllocator<ElementType, alignm
     static constexpr bool hasSIMDExtendedStorage = true;
 };
 
+template <class ElementType, size_t alignmentInBytes>
+struct StorageInfo<std::vector<ElementType, NumaLocalAllocator<ElementType, alignmentInBytes>>>
+{
+    constexpr StorageInfo init (const void*, size_t) { return *this; }
+
+    static constexpr size_t memberAlignment = alignof (std::vector<ElementType, NumaLocalAllocator<ElementType, alignmentInBytes>>);
+
+    static constexpr bool dataIsSIMDAligned = alignmentInBytes == Config::maxSIMDRegisterSize;
+
+    /** This is ensured by the NumaLocalAllocator */
+    static constexpr bool hasSIMDExtendedStorage = true;
+};
+
 template <class ElementType, size_t size>
 struct StorageInfo<std::array<ElementType, size>>
 {
@@ -178,19 +210,10 @@ struct StorageInfoWithMemberAlignment : WrappedInfo
     static constexpr size_t memberAlignment = alignment;
 };
 
-namespace detail
-{
-
-template <bool, bool>
-struct ConstexprStorageInfoChecker
-{
-};
-} // namespace detail
-
 namespace is
 {
 template <class T>
-concept constexprStorageInfo = requires (const T&) { detail::ConstexprStorageInfoChecker<T::dataIsSIMDAligned, T::hasSIMDExtendedStorage>(); };
+concept constexprStorageInfo = requires { { &T::dataIsSIMDAligned } -> std::same_as<const bool*>; { &T::hasSIMDExtendedStorage } -> std::same_as<const bool*>; };
 }
 
 template <class InfoA, class InfoB>
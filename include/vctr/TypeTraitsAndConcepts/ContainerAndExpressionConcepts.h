@@ -77,6 +77,14 @@ concept prepareNeonEvaluation = requires (const T& t) { t.prepareNeonEvaluation(
 template <class T>
 concept getNeon = requires (const T& t, size_t i) { t.getNeon (i); };
 
+/** Constrains a type to have a member function prepareAVX512Evaluation() const. */
+template <class T>
+concept prepareAVX512Evaluation = requires (const T& t) { t.prepareAVX512Evaluation(); };
+
+/** Constrains a type to have a member function getAVX512 (size_t) const. */
+template <class T>
+concept getAVX512 = requires (const T& t, size_t i) { t.getAVX512 (i); };
+
 /** Constrains a type to have a member function prepareAVXEvaluation() const. */
 template <class T>
 concept prepareAVXEvaluation = requires (const T& t) { t.prepareAVXEvaluation(); };
@@ -93,6 +101,20 @@ concept prepareSSEEvaluation = requires (const T& t) { t.prepareSSEEvaluation();
 template <class T>
 concept getSSE = requires (const T& t, size_t i) { t.getSSE (i); };
 
+/** Constrains a type to have a member function getAVX512Factors (size_t) const. It is implemented by multiplication
+    expressions to hand out both factor registers, so that an addition or subtraction can fuse them into an fma.
+ */
+template <class T>
+concept getAVX512Factors = requires (const T& t, size_t i) { t.getAVX512Factors (i); };
+
+/** Constrains a type to have a member function getAVXFactors (size_t) const, see getAVX512Factors. */
+template <class T>
+concept getAVXFactors = requires (const T& t, size_t i) { t.getAVXFactors (i); };
+
+/** Constrains a type to have a member function getSSEFactors (size_t) const, see getAVX512Factors. */
+template <class T>
+concept getSSEFactors = requires (const T& t, size_t i) { t.getSSEFactors (i); };
+
 /** Constrains a type to have a non const operator[] overload taking a size_t argument. */
 template <class T>
 concept indexOperator = requires (T& t) { t[size_t()]; };
@@ -109,6 +131,12 @@ concept evalNextVectorOpInExpressionChain = requires (const T& t, DstType* d) {
 template <class T, class ValueType>
 concept reduceElementWise = requires (const T&t, ValueType& v) { t.reduceElementWise (v, size_t()); };
 
+/** Constrains a type to have a member function reduceElementWise() const that takes two ValueType& arguments for the
+    result and a compensation value and a size_t argument.
+ */
+template <class T, class ValueType>
+concept reduceElementWiseCompensated = requires (const T&t, ValueType& v, ValueType& c) { t.reduceElementWise (v, c, size_t()); };
+
 /** Constrains a type to have a member function reduceVectorOp() const that returns a DstType value. */
 template <class T, class DstType>
 concept reduceVectorOp = requires (const T& t) { { t.reduceVectorOp() } -> std::same_as<DstType>; };
@@ -117,6 +145,10 @@ concept reduceVectorOp = requires (const T& t) { { t.reduceVectorOp() } -> std::
 template <class T, class SrcDstType>
 concept reduceNeonRegisterWise = requires (const T& t, NeonRegister<SrcDstType>& sd, size_t s) { t.reduceNeonRegisterWise (sd, s); };
 
+/** Constrains a type to have a member function reduceAVX512RegisterWise (AVX512Register<SrcDstType>&, size_t) const. */
+template <class T, class SrcDstType>
+concept reduceAVX512RegisterWise = requires (const T& t, AVX512Register<SrcDstType>& sd, size_t s) { t.reduceAVX512RegisterWise (sd, s); };
+
 /** Constrains a type to have a member function reduceAVXRegisterWise (AVXRegister<SrcDstType>&, size_t) const. */
 template <class T, class SrcDstType>
 concept reduceAVXRegisterWise = requires (const T& t, AVXRegister<SrcDstType>& sd, size_t s) { t.reduceAVXRegisterWise (sd, s); };
@@ -125,6 +157,72 @@ concept reduceAVXRegisterWise = requires (const T& t, AVXRegister<SrcDstType>& s
 template <class T, class SrcDstType>
 concept reduceSSERegisterWise = requires (const T& t, SSERegister<SrcDstType>& sd, size_t s) { t.reduceSSERegisterWise (sd, s); };
 
+/** Constrains a type to have a member function reduceNeonRegisterWise (NeonRegister<SrcDstType>&, NeonRegister<SrcDstType>&, size_t) const,
+    which reduces into an accumulator and a compensation register.
+ */
+template <class T, class SrcDstType>
+concept reduceNeonRegisterWiseCompensated = requires (const T& t, NeonRegister<SrcDstType>& sd, NeonRegister<SrcDstType>& c, size_t s) { t.reduceNeonRegisterWise (sd, c, s); };
+
+/** Constrains a type to have a member function reduceAVX512RegisterWise (AVX512Register<SrcDstType>&, AVX512Register<SrcDstType>&, size_t) const,
+    which reduces into an accumulator and a compensation register.
+ */
+template <class T, class SrcDstType>
+concept reduceAVX512RegisterWiseCompensated = requires (const T& t, AVX512Register<SrcDstType>& sd, AVX512Register<SrcDstType>& c, size_t s) { t.reduceAVX512RegisterWise (sd, c, s); };
+
+/** Constrains a type to have a member function reduceAVXRegisterWise (AVXRegister<SrcDstType>&, AVXRegister<SrcDstType>&, size_t) const,
+    which reduces into an accumulator and a compensation register.
+ */
+template <class T, class SrcDstType>
+concept reduceAVXRegisterWiseCompensated = requires (const T& t, AVXRegister<SrcDstType>& sd, AVXRegister<SrcDstType>& c, size_t s) { t.reduceAVXRegisterWise (sd, c, s); };
+
+/** Constrains a type to have a member function reduceSSERegisterWise (SSERegister<SrcDstType>&, SSERegister<SrcDstType>&, size_t) const,
+    which reduces into an accumulator and a compensation register.
+ */
+template <class T, class SrcDstType>
+concept reduceSSERegisterWiseCompensated = requires (const T& t, SSERegister<SrcDstType>& sd, SSERegister<SrcDstType>& c, size_t s) { t.reduceSSERegisterWise (sd, c, s); };
+
+/** Constrains a type to have a member function reduceAVX512RegisterWise (AVX512Register<SrcValueType>&, AVX512Register<SrcValueType>&, AVX512Register<SrcValueType>, size_t) const,
+    which reduces into a register of values and a register of the register indices they were found at.
+ */
+template <class T>
+concept reduceAVX512RegisterWiseWithIndex = requires (const T& t, AVX512Register<typename T::SrcValueType>& v, size_t s) { t.reduceAVX512RegisterWise (v, v, v, s); };
+
+/** Constrains a type to have a member function reduceAVXRegisterWise (AVXRegister<SrcValueType>&, AVXRegister<SrcValueType>&, AVXRegister<SrcValueType>, size_t) const,
+    which reduces into a register of values and a register of the register indices they were found at.
+ */
+template <class T>
+concept reduceAVXRegisterWiseWithIndex = requires (const T& t, AVXRegister<typename T::SrcValueType>& v, size_t s) { t.reduceAVXRegisterWise (v, v, v, s); };
+
+/** Constrains a type to have a member function reduceSSERegisterWise (SSERegister<SrcValueType>&, SSERegister<SrcValueType>&, SSERegister<SrcValueType>, size_t) const,
+    which reduces into a register of values and a register of the register indices they were found at.
+ */
+template <class T>
+concept reduceSSERegisterWiseWithIndex = requires (const T& t, SSERegister<typename T::SrcValueType>& v, size_t s) { t.reduceSSERegisterWise (v, v, v, s); };
+
+/** Constrains a type to have a member function reduceNeonRegisterWise (std::array<NeonRegister<SrcValueType>, N>&, size_t) const,
+    which reduces into one register for each of the N values of its value_type.
+ */
+template <class T>
+concept reduceNeonRegisterWiseMultiple = requires (const T& t, std::array<NeonRegister<typename T::SrcValueType>, std::tuple_size<typename T::value_type>::value>& r, size_t s) { t.reduceNeonRegisterWise (r, s); };
+
+/** Constrains a type to have a member function reduceAVX512RegisterWise (std::array<AVX512Register<SrcValueType>, N>&, size_t) const,
+    which reduces into one register for each of the N values of its value_type.
+ */
+template <class T>
+concept reduceAVX512RegisterWiseMultiple = requires (const T& t, std::array<AVX512Register<typename T::SrcValueType>, std::tuple_size<typename T::value_type>::value>& r, size_t s) { t.reduceAVX512RegisterWise (r, s); };
+
+/** Constrains a type to have a member function reduceAVXRegisterWise (std::array<AVXRegister<SrcValueType>, N>&, size_t) const,
+    which reduces into one register for each of the N values of its value_type.
+ */
+template <class T>
+concept reduceAVXRegisterWiseMultiple = requires (const T& t, std::array<AVXRegister<typename T::SrcValueType>, std::tuple_size<typename T::value_type>::value>& r, size_t s) { t.reduceAVXRegisterWise (r, s); };
+
+/** Constrains a type to have a member function reduceSSERegisterWise (std::array<SSERegister<SrcValueType>, N>&, size_t) const,
+    which reduces into one register for each of the N values of its value_type.
+ */
+template <class T>
+concept reduceSSERegisterWiseMultiple = requires (const T& t, std::array<SSERegister<typename T::SrcValueType>, std::tuple_size<typename T::value_type>::value>& r, size_t s) { t.reduceSSERegisterWise (r, s); };
+
 /** Constrains a type to have a member function data() const */
 template <class T>
 concept data = requires (const T& t) { t.data(); };
@@ -272,6 +370,10 @@ concept suitableForAccelerateRealIntToFloatVectorOp = detail::isPreferredVectorO
 /** A combined concept to check if Apple Accelerate is a suitable option for a floating point vector reduction operation. */
 template <class Src, class DstType, detail::PlatformVectorOpPreference pref = detail::preferIfIppAndAccelerateAreAvailable>
 concept suitableForAccelerateRealFloatVectorReductionOp = detail::isPreferredVectorOp<pref> && Config::platformApple && has::data<Src> && realFloatNumber<DstType>;
+
+/** A combined concept to check if Apple Accelerate is a suitable option for a real or complex floating point vector reduction operation. */
+template <class Src, class DstType, detail::PlatformVectorOpPreference pref = detail::preferIfIppAndAccelerateAreAvailable>
+concept suitableForAccelerateRealOrComplexFloatVectorReductionOp = detail::isPreferredVectorOp<pref> && Config::platformApple && has::data<Src> && (realFloatNumber<DstType> || complexFloatNumber<DstType>);
 //==============================================================================
 /** A combined concept to check if Intel IPP is a suitable option for a real valued floating point vector operation. */
 template <class Src, class DstType, detail::PlatformVectorOpPreference pref = detail::preferIfIppAndAccelerateAreAvailable>
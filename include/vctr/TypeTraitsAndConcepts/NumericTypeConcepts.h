@@ -86,6 +86,10 @@ concept complexFloatNumber = detail::IsComplex<std::remove_cvref_t<T>>::value;
 template <class T>
 concept realOrComplexFloatNumber = realFloatNumber<T> || complexFloatNumber<T>;
 
+/** Constrains a type to represent a 16 bit floating point storage type (e.g. float16 or bfloat16) */
+template <class T>
+concept halfPrecisionFloat = std::same_as<std::remove_cvref_t<T>, float16> || std::same_as<std::remove_cvref_t<T>, bfloat16>;
+
 /** Constrains a type to be of the type DisabledConstant */
 template <class T>
 concept disabledConstant = std::same_as<DisabledConstant, T>;
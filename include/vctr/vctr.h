@@ -59,6 +59,10 @@
 #include <numeric>
 #include <optional>
 #include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 #ifdef jassert
 #define VCTR_ASSERT(e) jassert (e)
@@ -73,6 +77,7 @@
 #include "Miscellaneous/Config.h"
 
 #include "Miscellaneous/CompilerSpecificAttributes.h"
+#include "Miscellaneous/HalfPrecisionFloat.h"
 
 #if VCTR_X64
 #include <immintrin.h>
@@ -86,6 +91,29 @@
 #include <Accelerate/Accelerate.h>
 #endif
 
+#if VCTR_WINDOWS
+// Only needed for VirtualAlloc, so we don't want to leak the min and max macros or the rest of the Windows API
+#ifndef NOMINMAX
+#define NOMINMAX
+#define VCTR_UNDEF_NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define VCTR_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#ifdef VCTR_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef VCTR_UNDEF_NOMINMAX
+#endif
+#ifdef VCTR_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef VCTR_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#else
+#include <sys/mman.h>
+#endif
+
 #if VCTR_USE_IPP
 #include <ipp.h>
 #endif
@@ -118,6 +146,10 @@ VCTR_END_IGNORE_WARNING_MSVC
     of the difference of the source vector src and the constant value 3. This expression
     can then be assigned to an existing Vector, Array or Span of a matching extent or be
     used to initialize a new Vector or Array.
+
+    @defgroup Algorithms
+    Functions that operate on whole containers and cannot be expressed as element-wise
+    expressions, like prefix scans.
  */
 
 #include "TypeTraitsAndConcepts/ContainerAndExpressionConcepts.h"
@@ -128,6 +160,7 @@ VCTR_END_IGNORE_WARNING_MSVC
 #include "SIMD/SIMDHelpers.h"
 #include "SIMD/SSE/SSERegister.h"
 #include "SIMD/AVX/AVXRegister.h"
+#include "SIMD/AVX512/AVX512Register.h"
 #include "SIMD/Neon/NeonRegister.h"
 
 #include "PlatformVectorOps/PlatformVectorOpsHelpers.h"
@@ -139,10 +172,11 @@ VCTR_END_IGNORE_WARNING_MSVC
 #include "Expressions/ExpressionTemplate.h"
 
 #include "Miscellaneous/Range.h"
+#include "Miscellaneous/ThreadPool.h"
 
+#include "Miscellaneous/AlignedAllocator.h"
 #include "Containers/VctrBase.h"
 #include "Containers/Span.h"
-#include "Miscellaneous/AlignedAllocator.h"
 #include "Containers/Vector.h"
 #include "Containers/Array.h"
 
@@ -160,16 +194,23 @@ VCTR_END_IGNORE_WARNING_MSVC
 #include "Expressions/BasicMath/Abs.h"
 #include "Expressions/BasicMath/Clamp.h"
 #include "Expressions/BasicMath/Cube.h"
+#include "Expressions/BasicMath/Reciprocal.h"
+#include "Expressions/BasicMath/Rsqrt.h"
 #include "Expressions/BasicMath/Sqrt.h"
 #include "Expressions/BasicMath/Square.h"
 #include "Expressions/BasicMath/Add.h"
 #include "Expressions/BasicMath/Subtract.h"
 #include "Expressions/BasicMath/Multiply.h"
 #include "Expressions/BasicMath/Divide.h"
+#include "Expressions/BasicMath/DotProduct.h"
 #include "Expressions/BasicMath/Max.h"
 #include "Expressions/BasicMath/Min.h"
 #include "Expressions/BasicMath/Mean.h"
+#include "Expressions/BasicMath/Norm.h"
+#include "Expressions/BasicMath/Stats.h"
+#include "Expressions/BasicMath/Moments.h"
 #include "Expressions/BasicMath/Sum.h"
+#include "Expressions/BasicMath/SumCompensated.h"
 #include "Expressions/BasicMath/NormalizeSum.h"
 
 #include "Expressions/Complex/Angle.h"
@@ -187,6 +228,7 @@ VCTR_END_IGNORE_WARNING_MSVC
 #include "Expressions/Trigonometric/Sin.h"
 #include "Expressions/Trigonometric/Cos.h"
 #include "Expressions/Trigonometric/Tan.h"
+#include "Expressions/Trigonometric/SinCos.h"
 #include "Expressions/Trigonometric/Sinh.h"
 #include "Expressions/Trigonometric/Cosh.h"
 #include "Expressions/Trigonometric/Tanh.h"
@@ -201,6 +243,11 @@ VCTR_END_IGNORE_WARNING_MSVC
 
 #include "Generators/Linspace.h"
 
+#include "Algorithms/Cumulative.h"
+#include "Algorithms/Sort.h"
+#include "Algorithms/Percentile.h"
+#include "Algorithms/EvaluateBatch.h"
+
 #include "Miscellaneous/StdOstreamOperator.h"
 
 //==============================================================================
@@ -25,6 +25,8 @@
 namespace vctr
 {
 struct DisabledConstant;
+class float16;
+class bfloat16;
 }
 
 #include <complex>
@@ -46,6 +48,10 @@ template <typename ElementType, size_t alignmentInBytes>
 requires (alignmentInBytes >= alignof (ElementType) && is::powerOfTwoInt<alignmentInBytes>)
 class AlignedAllocator;
 
+template <typename ElementType, size_t alignmentInBytes>
+requires (alignmentInBytes >= alignof (ElementType) && is::powerOfTwoInt<alignmentInBytes>)
+class NumaLocalAllocator;
+
 template <is::nonConst ElementType, template <class> class Allocator>
 class Vector;
 
@@ -61,6 +67,9 @@ struct ExpressionTemplateBase;
 template <template <size_t, class...> class ExpressionType, class RuntimeArgs, class... AdditionalCompileTimeParameters>
 struct ExpressionChainBuilderWithRuntimeArgs;
 
+template <class T>
+struct AVX512Register;
+
 template <class T>
 struct AVXRegister;
 
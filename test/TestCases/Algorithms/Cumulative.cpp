@@ -0,0 +1,148 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_PRODUCT_TEST_CASE ("Cumulative sum", "[cumulative]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, int64_t) )
+{
+    VCTR_TEST_DEFINES (45)
+
+    // Sizes that are no multiple of the register size leave some elements for the scalar loop
+    for (size_t n : { 1, 7, 17, 33, 44 })
+    {
+        const auto src = srcUnaligned.subSpan (0, n);
+        std::vector<ElementType> ref (n);
+        std::inclusive_scan (src.begin(), src.end(), ref.begin());
+
+        const vctr::Vector sum = vctr::cumulativeSum (filter << src);
+
+        // In place evaluation
+        vctr::Vector inPlace (srcD);
+        auto inPlaceSpan = inPlace.subSpan (1, n);
+        vctr::cumulativeSum (filter << inPlaceSpan, inPlaceSpan);
+
+        REQUIRE (sum.size() == n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if constexpr (vctr::is::realFloatNumber<ElementType>)
+            {
+                // The sum of values in the range -100 to 100 might be close to zero, so we check the absolute error here
+                REQUIRE_THAT (sum[i], Catch::Matchers::WithinAbs (ref[i], 0.01));
+                REQUIRE_THAT (inPlaceSpan[i], Catch::Matchers::WithinAbs (ref[i], 0.01));
+            }
+            else
+            {
+                REQUIRE (sum[i] == ref[i]);
+                REQUIRE (inPlaceSpan[i] == ref[i]);
+            }
+        }
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Cumulative product", "[cumulative]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double) )
+{
+    VCTR_TEST_DEFINES_NO_ZEROS_IN_RANGE (-2, 2, 45)
+
+    for (size_t n : { 1, 7, 17, 33, 44 })
+    {
+        const auto src = srcUnaligned.subSpan (0, n);
+        std::vector<ElementType> ref (n);
+        std::inclusive_scan (src.begin(), src.end(), ref.begin(), std::multiplies<>());
+
+        vctr::Vector<ElementType> product (n);
+        vctr::cumulativeProduct (filter << src, product);
+
+        for (size_t i = 0; i < n; ++i)
+            REQUIRE_THAT (product[i], Catch::Matchers::WithinRel (ref[i], ElementType (0.0001)));
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Cumulative max", "[cumulative]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t) )
+{
+    VCTR_TEST_DEFINES (45)
+
+    for (size_t n : { 1, 7, 17, 33, 44 })
+    {
+        const auto src = srcUnaligned.subSpan (0, n);
+        std::vector<ElementType> ref (n);
+        std::inclusive_scan (src.begin(), src.end(), ref.begin(), [] (auto a, auto b) { return std::max (a, b); });
+
+        const vctr::Vector max = vctr::cumulativeMax (filter << src);
+
+        for (size_t i = 0; i < n; ++i)
+            REQUIRE (max[i] == ref[i]);
+    }
+
+    // Expressions are evaluated on the fly
+    const vctr::Vector maxAbs = vctr::cumulativeMax (filter << vctr::abs << srcC);
+    REQUIRE (maxAbs.back() == (vctr::maxAbs << srcC));
+}
+
+TEST_CASE ("Cumulative sum of an array", "[cumulative]")
+{
+    constexpr vctr::Array src { 3, 1, 4, 1, 5 };
+    constexpr auto sum = vctr::cumulativeSum (src);
+
+    static_assert (std::same_as<decltype (sum), const vctr::Array<int, 5>>);
+    static_assert (sum[4] == 14);
+
+    REQUIRE_THAT (sum, vctr::Equals ({ 3, 4, 8, 9, 14 }));
+}
+
+TEMPLATE_TEST_CASE ("Cumulative scan on multiple threads", "[cumulative]", double, int64_t)
+{
+    // Small integer values keep the floating point sums exact, so that the result does not depend on the summation order
+    const size_t n = (size_t (1) << 20) + 7;
+    vctr::Vector<TestType> src (n);
+
+    for (size_t i = 0; i < n; ++i)
+        src[i] = TestType (int (i % 7) - 3);
+
+    vctr::ThreadPool pool (8);
+    vctr::Vector<TestType> singleThreaded (n);
+    vctr::Vector<TestType> multiThreaded (n);
+
+    vctr::cumulativeSum (src, singleThreaded);
+    vctr::cumulativeSum (src, multiThreaded, pool);
+    REQUIRE_THAT (multiThreaded, vctr::Equals (singleThreaded));
+    REQUIRE_THAT (vctr::cumulativeSum (src, pool), vctr::Equals (singleThreaded));
+
+    vctr::cumulativeMax (src * TestType (2), singleThreaded);
+    vctr::cumulativeMax (src * TestType (2), multiThreaded, pool);
+    REQUIRE_THAT (multiThreaded, vctr::Equals (singleThreaded));
+
+    // Products of alternating signs are exact
+    vctr::Vector<TestType> signs (n);
+
+    for (size_t i = 0; i < n; ++i)
+        signs[i] = i % 3 == 0 ? TestType (-1) : TestType (1);
+
+    vctr::cumulativeProduct (signs, singleThreaded);
+    vctr::cumulativeProduct (signs, multiThreaded, pool);
+    REQUIRE_THAT (multiThreaded, vctr::Equals (singleThreaded));
+
+    // In place evaluation
+    vctr::cumulativeSum (src, singleThreaded);
+    vctr::cumulativeSum (src, src, pool);
+    REQUIRE_THAT (src, vctr::Equals (singleThreaded));
+}
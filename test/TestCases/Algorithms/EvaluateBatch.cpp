@@ -0,0 +1,66 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("evaluateBatch", "[evaluateBatch]", float, double, int32_t)
+{
+    vctr::ThreadPool pool (4);
+
+    // Sources of very different lengths, including empty ones
+    std::vector<vctr::Vector<TestType>> srcs;
+
+    for (size_t i = 0; i < 100; ++i)
+        srcs.emplace_back ((i * 7919) % 5000, TestType (int (i % 10) - 5));
+
+    const auto chain = vctr::square << vctr::abs;
+
+    std::vector<vctr::Vector<TestType>> dsts (srcs.size());
+    vctr::evaluateBatch (dsts, srcs, chain, pool);
+
+    for (size_t i = 0; i < srcs.size(); ++i)
+    {
+        const vctr::Vector<TestType> expected = chain << srcs[i];
+        REQUIRE_THAT (dsts[i], vctr::Equals (expected));
+    }
+
+    // Spans as destinations
+    std::vector<vctr::Vector<TestType>> storage;
+
+    for (const auto& src : srcs)
+        storage.emplace_back (src.size());
+
+    std::vector<vctr::Span<TestType>> spans (storage.begin(), storage.end());
+    vctr::evaluateBatch (spans, srcs, chain, pool);
+
+    for (size_t i = 0; i < srcs.size(); ++i)
+        REQUIRE_THAT (storage[i], vctr::Equals (dsts[i]));
+
+    // Reductions into values, which are not allowed for empty sources
+    std::erase_if (srcs, [] (const auto& src) { return src.empty(); });
+
+    std::vector<TestType> sums (srcs.size());
+    vctr::evaluateBatch (sums, srcs, vctr::sum, pool);
+
+    for (size_t i = 0; i < srcs.size(); ++i)
+        REQUIRE (sums[i] == vctr::sum << srcs[i]);
+}
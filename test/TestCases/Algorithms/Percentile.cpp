@@ -0,0 +1,94 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+/** Computes the percentile by sorting the values and interpolating between the two closest ranks. */
+template <class T>
+double referencePercentile (std::vector<T> values, double percentage)
+{
+    std::sort (values.begin(), values.end());
+
+    const auto rank = percentage / 100.0 * double (values.size() - 1);
+    const auto i = size_t (rank);
+
+    if (i + 1 == values.size())
+        return double (values[i]);
+
+    return double (values[i]) + (rank - double (i)) * (double (values[i + 1]) - double (values[i]));
+}
+
+TEMPLATE_TEST_CASE ("Percentile", "[percentile]", float, double, int32_t, uint32_t, int64_t)
+{
+    const auto values = UnitTestValues<TestType>::template vector<100, 0, 0, 1000>();
+
+    // Odd and even sizes, below and above the size that is sorted by sorting networks
+    for (size_t n : { 1, 2, 7, 64, 100 })
+    {
+        const auto src = values.subSpan (0, n);
+        const std::vector<TestType> ref (src.begin(), src.end());
+
+        REQUIRE_THAT (vctr::median (src), Catch::Matchers::WithinRel (referencePercentile (ref, 50.0), 0.0001));
+        REQUIRE_THAT (vctr::percentile<90> (src), Catch::Matchers::WithinRel (referencePercentile (ref, 90.0), 0.0001));
+        REQUIRE_THAT (vctr::percentile (src, 0.0), Catch::Matchers::WithinRel (referencePercentile (ref, 0.0), 0.0001));
+        REQUIRE_THAT (vctr::percentile (src, 100.0), Catch::Matchers::WithinRel (referencePercentile (ref, 100.0), 0.0001));
+        REQUIRE_THAT (vctr::percentile (src, 33.3), Catch::Matchers::WithinRel (referencePercentile (ref, 33.3), 0.0001));
+
+        // The percentages don't need to be sorted or unique
+        const vctr::Array percentages { 95.0, 5.0, 50.0, 25.0, 75.0, 50.0 };
+        const auto result = vctr::percentiles (src, percentages);
+
+        for (size_t i = 0; i < percentages.size(); ++i)
+            REQUIRE_THAT (result[i], Catch::Matchers::WithinRel (referencePercentile (ref, percentages[i]), 0.0001));
+
+        // The source stays unchanged
+        REQUIRE (std::equal (src.begin(), src.end(), ref.begin()));
+    }
+}
+
+TEMPLATE_TEST_CASE ("Percentile of random values", "[percentile]", float, double, int32_t, uint32_t)
+{
+    for (size_t n : { 257, 1000, 4999, 20000 })
+    {
+        const auto src = randomTestValues<TestType> (n, uint32_t (n));
+        const std::vector<TestType> ref (src.begin(), src.end());
+
+        REQUIRE_THAT (vctr::median (src), Catch::Matchers::WithinRel (referencePercentile (ref, 50.0), 0.0001));
+
+        const vctr::Array percentages { 0.0, 1.0, 25.0, 50.0, 90.0, 99.9, 100.0 };
+        const auto result = vctr::percentiles (src, percentages);
+
+        for (size_t i = 0; i < percentages.size(); ++i)
+        {
+            REQUIRE_THAT (result[i], Catch::Matchers::WithinRel (referencePercentile (ref, percentages[i]), 0.0001));
+            REQUIRE_THAT (vctr::percentile (src, percentages[i]), Catch::Matchers::WithinRel (referencePercentile (ref, percentages[i]), 0.0001));
+        }
+    }
+}
+
+TEST_CASE ("Percentile of an expression", "[percentile]")
+{
+    const vctr::Vector values { 4.0f, -1.0f, 3.0f, -2.0f };
+
+    REQUIRE (vctr::median (vctr::abs << values) == 2.5f);
+    REQUIRE_THAT (vctr::percentiles (values * 2.0f, vctr::Vector { 0, 100 }), vctr::Equals ({ -4.0f, 8.0f }));
+}
@@ -88,3 +88,77 @@ TEMPLATE_PRODUCT_TEST_CASE ("Addition in place", "[add]", (PlatformVectorOps, VC
         }
     }
 }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Fused multiply add", "[add][subtract]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double) )
+{
+    VCTR_TEST_DEFINES (10)
+
+    // Multiplications as direct sources of additions and subtractions are fused into a single fma instruction
+    // on platforms that support it, so we only expect the results to be close to the unfused computation
+    const vctr::Vector fma1 = filter << srcA * srcB + srcC;
+    const vctr::Vector fma2 = filter << srcC + srcA * srcB;
+    const vctr::Vector fms1 = filter << srcA * srcB - srcC;
+    const vctr::Vector fms2 = filter << srcC - srcA * srcB;
+
+    const auto eps = ElementType (0.00001);
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        REQUIRE_THAT (fma1[i], Catch::Matchers::WithinRel (srcA[i] * srcB[i] + srcC[i], eps));
+        REQUIRE_THAT (fma2[i], Catch::Matchers::WithinRel (srcC[i] + srcA[i] * srcB[i], eps));
+        REQUIRE_THAT (fms1[i], Catch::Matchers::WithinRel (srcA[i] * srcB[i] - srcC[i], eps));
+        REQUIRE_THAT (fms2[i], Catch::Matchers::WithinRel (srcC[i] - srcA[i] * srcB[i], eps));
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Addition of odd sized spans", "[add]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, uint32_t) )
+{
+    VCTR_TEST_DEFINES (45)
+
+    // The remaining elements of sizes that are no multiple of the register size are computed by an overlapping register
+    for (size_t n : { 1, 7, 17, 33, 44 })
+    {
+        const auto a = srcC.subSpan (1, n);
+        const auto b = srcD.subSpan (0, n);
+
+        vctr::Vector<ElementType> dst (n + 1);
+        auto dstSpan = dst.subSpan (1, n);
+        dstSpan = filter << a + b;
+
+        REQUIRE_THAT (dstSpan, vctr::EqualsTransformedBy<addition> (a, b));
+
+        // In place evaluation
+        vctr::Vector inPlace (srcC);
+        auto inPlaceSpan = inPlace.subSpan (1, n);
+        inPlaceSpan = filter << inPlaceSpan + b;
+
+        REQUIRE_THAT (inPlaceSpan, vctr::EqualsTransformedBy<addition> (a, b));
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Addition into unaligned spans", "[add]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, uint32_t) )
+{
+    VCTR_TEST_DEFINES (80)
+
+    // Elements before the first aligned destination address are computed by an overlapping head register
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        const auto n = size_t (64);
+        const auto a = srcC.subSpan (offset, n);
+        const auto b = srcD.subSpan (0, n);
+
+        vctr::Vector<ElementType> dst (n + offset, ElementType (0));
+        auto dstSpan = dst.subSpan (offset, n);
+        dstSpan = filter << a + b;
+
+        REQUIRE_THAT (dstSpan, vctr::EqualsTransformedBy<addition> (a, b));
+        REQUIRE (dst.subSpan (0, offset).allElementsEqual (ElementType (0)));
+
+        // In place evaluation
+        vctr::Vector inPlace (srcC);
+        auto inPlaceSpan = inPlace.subSpan (offset, n);
+        inPlaceSpan = filter << inPlaceSpan + b;
+
+        REQUIRE_THAT (inPlaceSpan, vctr::EqualsTransformedBy<addition> (a, b));
+    }
+}
@@ -34,6 +34,9 @@ auto clamp (T x) { return std::clamp (x, T (lo), T (hi)); }
 template <int bound, int factor, vctr::is::realNumber T>
 auto clampLowMultiply (T x) { return std::max (x, T (bound)) * T (factor); }
 
+template <int lo, int hi, vctr::is::realNumber T>
+auto multiplyClamp (T a, T b) { return std::clamp (T (a * b), T (lo), T (hi)); }
+
 TEMPLATE_PRODUCT_TEST_CASE ("ClampLow", "[clamp]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, int64_t) )
 {
     VCTR_TEST_DEFINES (10)
@@ -79,4 +82,10 @@ TEMPLATE_PRODUCT_TEST_CASE ("ClampLow", "[clamp]", (PlatformVectorOps, VCTR_NATI
         const vctr::Vector res = filter << (vctr::clampLow (ElementType (4)) << srcA) * ElementType (2);
         REQUIRE_THAT (res, (vctr::EqualsTransformedBy<clampLowMultiply<4, 2>> (srcA)));
     }
+
+    SECTION ("clamp of a multiplication")
+    {
+        const vctr::Vector res = filter << vctr::clamp (ElementType (-50), ElementType (50)) << (srcC * srcD);
+        REQUIRE_THAT (res, (vctr::EqualsTransformedBy<multiplyClamp<-50, 50>> (srcC, srcD)));
+    }
 }
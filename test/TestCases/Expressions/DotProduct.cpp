@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_PRODUCT_TEST_CASE ("DotProduct", "[dotProduct]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, std::complex<float>, std::complex<double>, int32_t, int64_t) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    // Large enough to be reduced by the unrolled loop with independent accumulators, followed by single registers
+    const auto dot = vctr::dotProduct (filter << srcC, srcD);
+    const auto dotU = vctr::dotProduct (filter << srcUnaligned, srcD.subSpan (0, srcUnaligned.size()));
+    const auto inner = vctr::innerProduct (filter << srcC, srcD);
+
+    const auto ref = std::transform_reduce (srcC.begin(), srcC.end(), srcD.begin(), ElementType (0));
+    const auto refU = std::transform_reduce (srcUnaligned.begin(), srcUnaligned.end(), srcD.begin(), ElementType (0));
+
+    if constexpr (vctr::is::complexFloatNumber<ElementType>)
+    {
+        const auto refInner = std::transform_reduce (srcC.begin(), srcC.end(), srcD.begin(), ElementType (0), std::plus(), [] (auto a, auto b) { return a * std::conj (b); });
+
+        const auto eps = vctr::RealType<ElementType> (0.0001) * (vctr::sum << vctr::abs << srcC * srcD);
+
+        REQUIRE_THAT (dot.real(), Catch::Matchers::WithinAbs (ref.real(), eps));
+        REQUIRE_THAT (dot.imag(), Catch::Matchers::WithinAbs (ref.imag(), eps));
+        REQUIRE_THAT (dotU.real(), Catch::Matchers::WithinAbs (refU.real(), eps));
+        REQUIRE_THAT (dotU.imag(), Catch::Matchers::WithinAbs (refU.imag(), eps));
+        REQUIRE_THAT (inner.real(), Catch::Matchers::WithinAbs (refInner.real(), eps));
+        REQUIRE_THAT (inner.imag(), Catch::Matchers::WithinAbs (refInner.imag(), eps));
+    }
+    else if constexpr (vctr::is::realFloatNumber<ElementType>)
+    {
+        // Products of values in the range -100 to 100 might sum up to a value close to zero, so we check the absolute
+        // error relative to the sum of the absolute products here
+        const auto eps = ElementType (0.0001) * (vctr::sum << vctr::abs << srcC * srcD);
+
+        REQUIRE_THAT (dot, Catch::Matchers::WithinAbs (ref, eps));
+        REQUIRE_THAT (dotU, Catch::Matchers::WithinAbs (refU, eps));
+        REQUIRE (dot == inner);
+    }
+    else
+    {
+        REQUIRE (dot == ref);
+        REQUIRE (dotU == refU);
+        REQUIRE (dot == inner);
+    }
+}
+
+TEMPLATE_TEST_CASE ("DotProduct of complex vectors", "[dotProduct]", std::complex<float>, std::complex<double>)
+{
+    using RealType = vctr::RealType<TestType>;
+
+    // Sizes that cover the unrolled loop, single registers and the remaining elements of all register sizes, with
+    // sources that don't start at the beginning of the allocated memory
+    const auto realA = randomTestValues<RealType> (2 * 300, 1);
+    const auto realB = randomTestValues<RealType> (2 * 300, 2);
+
+    vctr::Vector<TestType> a (300);
+    vctr::Vector<TestType> b (300);
+
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = { realA[2 * i] / RealType (1e6), realA[2 * i + 1] / RealType (1e6) };
+        b[i] = { realB[2 * i] / RealType (1e6), realB[2 * i + 1] / RealType (1e6) };
+    }
+
+    for (size_t offset : { 0, 1, 3 })
+    {
+        for (size_t n = 1; n + offset <= a.size(); n += n < 40 ? 1 : 23)
+        {
+            const auto spanA = a.subSpan (offset, n);
+            const auto spanB = b.subSpan (2 * offset / 3, n);
+
+            TestType ref = 0;
+            TestType refInner = 0;
+            RealType sumOfAbs = 0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                ref += spanA[i] * spanB[i];
+                refInner += spanA[i] * std::conj (spanB[i]);
+                sumOfAbs += std::abs (spanA[i] * spanB[i]);
+            }
+
+            const auto dot = vctr::dotProduct (spanA, spanB);
+            const auto inner = vctr::innerProduct (spanA, spanB);
+            const auto eps = RealType (1e-5) * sumOfAbs;
+
+            REQUIRE_THAT (dot.real(), Catch::Matchers::WithinAbs (ref.real(), eps));
+            REQUIRE_THAT (dot.imag(), Catch::Matchers::WithinAbs (ref.imag(), eps));
+            REQUIRE_THAT (inner.real(), Catch::Matchers::WithinAbs (refInner.real(), eps));
+            REQUIRE_THAT (inner.imag(), Catch::Matchers::WithinAbs (refInner.imag(), eps));
+        }
+    }
+}
+
+TEST_CASE ("DotProduct constexpr", "[dotProduct]")
+{
+    constexpr vctr::Array a { 1.0, 2.0, 3.0 };
+    constexpr vctr::Array b { 4.0, 5.0, 6.0 };
+
+    static_assert (vctr::dotProduct (a, b) == 32.0);
+    static_assert (vctr::dotProduct (a, a * b) == 78.0);
+
+    constexpr vctr::Array c { std::complex (1.0, 1.0), std::complex (2.0, -1.0) };
+
+    static_assert (vctr::dotProduct (c, c) == std::complex (3.0, -2.0));
+    static_assert (vctr::innerProduct (c, c) == std::complex (7.0, 0.0));
+}
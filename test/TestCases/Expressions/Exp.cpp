@@ -45,3 +45,28 @@ TEMPLATE_PRODUCT_TEST_CASE ("Exp", "[exp]", (PlatformVectorOps, VCTR_NATIVE_SIMD
     REQUIRE_THAT (expU, vctr::EqualsTransformedBy<div10exp> (srcUnaligned).withEpsilon (0.00005));
     // clang-format on
 }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Exp of special values", "[exp]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    using ElementType = typename TestType::ElementType;
+    using Limits = std::numeric_limits<ElementType>;
+
+    const auto& filter = TestType::filter;
+
+    // The arguments that produce subnormal, zero and infinite results depend on the range of the type
+    constexpr auto isFloat = std::same_as<ElementType, float>;
+    const auto subnormalResult = ElementType (isFloat ? -100 : -740);
+    const auto zeroResult = ElementType (isFloat ? -110 : -750);
+    const auto largestResult = ElementType (isFloat ? 88 : 709);
+    const auto infResult = ElementType (isFloat ? 89 : 710);
+
+    // Enough values to fill a register of every instruction set
+    const vctr::Vector<ElementType> src { -Limits::infinity(), Limits::infinity(), Limits::quiet_NaN(), ElementType (0),
+                                          -ElementType (0), Limits::denorm_min(), -Limits::denorm_min(), subnormalResult,
+                                          zeroResult, largestResult, infResult, ElementType (1),
+                                          ElementType (-1), ElementType (0.5), ElementType (10), ElementType (-10) };
+
+    const vctr::Vector exp = filter << vctr::exp << src;
+
+    requireSameResultsAsStdLib (exp, src, [] (ElementType x) { return std::exp (x); }, 2);
+}
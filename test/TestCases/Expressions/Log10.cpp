@@ -39,3 +39,21 @@ TEMPLATE_PRODUCT_TEST_CASE ("Log10", "[log10]", (PlatformVectorOps, VCTR_NATIVE_
     REQUIRE_THAT (log10, vctr::EqualsTransformedBy<absLog10> (srcA).withMargin (0.000001));
     REQUIRE_THAT (log10U, vctr::EqualsTransformedBy<absLog10> (srcUnaligned).withMargin (0.000001));
 }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Log10 of special values", "[log10]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    using ElementType = typename TestType::ElementType;
+    using Limits = std::numeric_limits<ElementType>;
+
+    const auto& filter = TestType::filter;
+
+    // Enough values to fill a register of every instruction set
+    const vctr::Vector<ElementType> src { -Limits::infinity(), Limits::infinity(), Limits::quiet_NaN(), ElementType (0),
+                                          -ElementType (0), ElementType (-1), Limits::denorm_min(), Limits::min() / ElementType (3),
+                                          Limits::min(), Limits::max(), ElementType (1), ElementType (2),
+                                          ElementType (0.5), ElementType (10), ElementType (1000), ElementType (1e-30) };
+
+    const vctr::Vector log10 = filter << vctr::log10 << src;
+
+    requireSameResultsAsStdLib (log10, src, [] (ElementType x) { return std::log10 (x); }, 2);
+}
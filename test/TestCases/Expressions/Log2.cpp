@@ -39,3 +39,21 @@ TEMPLATE_PRODUCT_TEST_CASE ("Log2", "[log2]", (PlatformVectorOps, VCTR_NATIVE_SI
     REQUIRE_THAT (log2, vctr::EqualsTransformedBy<absLog2> (srcA).withMargin (0.000001));
     REQUIRE_THAT (log2U, vctr::EqualsTransformedBy<absLog2> (srcUnaligned).withMargin (0.000001));
 }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Log2 of special values", "[log2]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    using ElementType = typename TestType::ElementType;
+    using Limits = std::numeric_limits<ElementType>;
+
+    const auto& filter = TestType::filter;
+
+    // Enough values to fill a register of every instruction set
+    const vctr::Vector<ElementType> src { -Limits::infinity(), Limits::infinity(), Limits::quiet_NaN(), ElementType (0),
+                                          -ElementType (0), ElementType (-1), Limits::denorm_min(), Limits::min() / ElementType (3),
+                                          Limits::min(), Limits::max(), ElementType (1), ElementType (2),
+                                          ElementType (0.5), ElementType (10), ElementType (1000), ElementType (1e-30) };
+
+    const vctr::Vector log2 = filter << vctr::log2 << src;
+
+    requireSameResultsAsStdLib (log2, src, [] (ElementType x) { return std::log2 (x); }, 2);
+}
@@ -42,4 +42,50 @@ TEMPLATE_PRODUCT_TEST_CASE ("Max", "[max]", (PlatformVectorOps, VCTR_NATIVE_SIMD
     REQUIRE (maxAbs == srcA.maxAbs());
     REQUIRE (maxAbs == *std::max_element (srcAbs.begin(), srcAbs.end()));
     REQUIRE (maxAbsU == *std::max_element (srcAbsU.begin(), srcAbsU.end()));
-}
\ No newline at end of file
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Max of odd sized spans", "[max]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, int64_t, uint32_t, uint64_t) )
+{
+    VCTR_TEST_DEFINES (45)
+
+    // The remaining elements of sizes that are no multiple of the register size are reduced by an overlapping register
+    for (size_t n : { 1, 7, 17, 33, 44 })
+    {
+        const auto src = srcC.subSpan (1, n);
+
+        REQUIRE ((vctr::max << filter << src) == *std::max_element (src.begin(), src.end()));
+        REQUIRE ((vctr::min << filter << src) == *std::min_element (src.begin(), src.end()));
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("IndexOfMax", "[max]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, int64_t, uint32_t, uint64_t) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    // Lanes are reduced independently and combined afterwards, the first index of equal values is expected
+    auto srcWithDuplicates = srcC;
+    srcWithDuplicates[170] = srcWithDuplicates.max();
+    srcWithDuplicates[5] = srcWithDuplicates.max();
+
+    for (size_t n : { 1, 7, 17, 33, 44, 171, 299 })
+    {
+        const auto src = srcWithDuplicates.subSpan (1, n);
+
+        vctr::Vector srcAbs = vctr::abs << src;
+
+        REQUIRE ((vctr::indexOfMax << filter << src) == size_t (std::distance (src.begin(), std::max_element (src.begin(), src.end()))));
+        REQUIRE ((vctr::indexOfMaxAbs << filter << src) == size_t (std::distance (srcAbs.begin(), std::max_element (srcAbs.begin(), srcAbs.end()))));
+        REQUIRE ((vctr::indexOfMax << filter << src) == src.indexOfMaxElement());
+    }
+
+    static_assert ((vctr::indexOfMax << srcA) == size_t (std::distance (srcA.begin(), std::max_element (srcA.begin(), srcA.end()))));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("IndexOfMax of expressions", "[max]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (std::complex<float>, std::complex<double>) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    const vctr::Vector powerSpectrum = vctr::powerSpectrum << srcC;
+
+    REQUIRE ((vctr::indexOfMax << filter << vctr::powerSpectrum << srcC) == size_t (std::distance (powerSpectrum.begin(), std::max_element (powerSpectrum.begin(), powerSpectrum.end()))));
+}
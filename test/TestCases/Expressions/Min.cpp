@@ -48,4 +48,24 @@ TEMPLATE_PRODUCT_TEST_CASE ("Min", "[min]", (PlatformVectorOps, VCTR_NATIVE_SIMD
     REQUIRE (minAbs == *std::min_element (srcAbs.begin(), srcAbs.end()));
     REQUIRE (minAbsU == *std::min_element (srcAbsU.begin(), srcAbsU.end()));
     REQUIRE (minAbsNeg == *std::min_element (srcAbsNeg.begin(), srcAbsNeg.end()));
-}
\ No newline at end of file
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("IndexOfMin", "[min]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, int64_t, uint32_t, uint64_t) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    // Lanes are reduced independently and combined afterwards, the first index of equal values is expected
+    auto srcWithDuplicates = srcC;
+    srcWithDuplicates[170] = srcWithDuplicates.min();
+    srcWithDuplicates[5] = srcWithDuplicates.min();
+
+    for (size_t n : { 1, 7, 17, 33, 44, 171, 299 })
+    {
+        const auto src = srcWithDuplicates.subSpan (1, n);
+
+        REQUIRE ((vctr::indexOfMin << filter << src) == size_t (std::distance (src.begin(), std::min_element (src.begin(), src.end()))));
+        REQUIRE ((vctr::indexOfMin << filter << src) == src.indexOfMinElement());
+    }
+
+    static_assert ((vctr::indexOfMin << srcA) == size_t (std::distance (srcA.begin(), std::min_element (srcA.begin(), srcA.end()))));
+}
@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <class T>
+vctr::CentralMoments<long double> twoPassMoments (const T& src)
+{
+    vctr::CentralMoments<long double> moments;
+    moments.count = (long double) src.size();
+    moments.mean = std::accumulate (src.begin(), src.end(), 0.0L) / moments.count;
+
+    for (auto x : src)
+    {
+        const auto d = x - moments.mean;
+        moments.m2 += d * d;
+        moments.m3 += d * d * d;
+        moments.m4 += d * d * d * d;
+    }
+
+    return moments;
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Moments", "[moments]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    // A constant offset that is large compared to the spread of the values makes the naive computation of the
+    // variance as meanSquare - mean * mean unusable for float values
+    for (auto offset : { ElementType (0), ElementType (10000) })
+    {
+        for (size_t n : { 2, 7, 17, 33, 44, 171, 299 })
+        {
+            const vctr::Vector src = srcC.subSpan (1, n) + offset;
+            const auto ref = twoPassMoments (src);
+
+            const auto eps = ElementType (0.001);
+
+            REQUIRE_THAT (vctr::variance << filter << src, Catch::Matchers::WithinRel (double (ref.variance()), eps));
+            REQUIRE_THAT (vctr::stdDev << filter << src, Catch::Matchers::WithinRel (double (ref.stdDev()), eps));
+            REQUIRE_THAT (vctr::skewness << filter << src, Catch::Matchers::WithinAbs (double (ref.skewness()), eps));
+            REQUIRE_THAT (vctr::kurtosis << filter << src, Catch::Matchers::WithinAbs (double (ref.kurtosis()), eps));
+
+            const auto moments = vctr::moments << filter << src;
+
+            REQUIRE (moments.count == ElementType (n));
+            REQUIRE_THAT (moments.mean, Catch::Matchers::WithinAbs (double (ref.mean), eps * (offset + ElementType (1))));
+            REQUIRE_THAT (moments.variance(), Catch::Matchers::WithinRel (double (ref.variance()), eps));
+        }
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Merge moments", "[moments]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    const auto ref = twoPassMoments (srcC);
+    const auto eps = ElementType (0.001);
+
+    for (size_t split : { 1, 17, 150, 299 })
+    {
+        auto merged = vctr::moments << filter << srcC.subSpan (0, split);
+        merged.merge (vctr::moments << filter << srcC.subSpan (split));
+
+        REQUIRE (merged.count == ElementType (300));
+        REQUIRE_THAT (merged.mean, Catch::Matchers::WithinAbs (double (ref.mean), eps));
+        REQUIRE_THAT (merged.variance(), Catch::Matchers::WithinRel (double (ref.variance()), eps));
+        REQUIRE_THAT (merged.skewness(), Catch::Matchers::WithinAbs (double (ref.skewness()), eps));
+        REQUIRE_THAT (merged.kurtosis(), Catch::Matchers::WithinAbs (double (ref.kurtosis()), eps));
+    }
+}
+
+TEST_CASE ("Moments constexpr", "[moments]")
+{
+    constexpr vctr::Array src { 1.0, 2.0, 3.0, 4.0 };
+
+    static_assert ((vctr::variance << src) == 1.25);
+    static_assert ((vctr::moments << src).mean == 2.5);
+}
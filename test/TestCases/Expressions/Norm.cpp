@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_PRODUCT_TEST_CASE ("Norms", "[norm]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, std::complex<float>, std::complex<double>) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    using RealType = vctr::RealType<ElementType>;
+
+    for (size_t n : { 1, 7, 17, 33, 44, 171, 299 })
+    {
+        const auto src = srcC.subSpan (1, n);
+        const vctr::Vector srcAbs = vctr::abs << src;
+
+        const auto refL1 = std::reduce (srcAbs.begin(), srcAbs.end());
+        const auto refL2 = std::sqrt (std::transform_reduce (srcAbs.begin(), srcAbs.end(), srcAbs.begin(), RealType (0)));
+        const auto refLInf = *std::max_element (srcAbs.begin(), srcAbs.end());
+
+        const auto eps = RealType (0.0001);
+
+        REQUIRE_THAT (vctr::l1Norm << filter << src, Catch::Matchers::WithinRel (refL1, eps));
+        REQUIRE_THAT (vctr::l2Norm << filter << src, Catch::Matchers::WithinRel (refL2, eps));
+        REQUIRE ((vctr::lInfNorm << filter << src) == refLInf);
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("L2Norm close to the floating point limits", "[norm]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, std::complex<float>, std::complex<double>) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    using RealType = vctr::RealType<ElementType>;
+
+    const auto srcAbs = vctr::abs << srcC;
+    const auto scale = vctr::maxAbs << srcC;
+    const auto ref = std::sqrt (vctr::sum << vctr::square << srcAbs / scale);
+
+    // The squares of these values over- or underflow, which is handled by scaling the values before squaring them
+    for (auto factor : { std::numeric_limits<RealType>::max() / RealType (100), std::numeric_limits<RealType>::min() * RealType (100) })
+    {
+        const vctr::Vector src = srcC * ElementType (factor / scale);
+
+        REQUIRE_THAT (vctr::l2Norm << filter << src, Catch::Matchers::WithinRel (ref * factor, RealType (0.0001)));
+    }
+
+    const vctr::Vector zeros (300, ElementType (0));
+    REQUIRE ((vctr::l2Norm << filter << zeros) == RealType (0));
+
+    // NaN values propagate to the result, also if they are mixed with zeros or inf
+    const auto nan = std::numeric_limits<RealType>::quiet_NaN();
+    const auto inf = std::numeric_limits<RealType>::infinity();
+
+    const vctr::Vector nans (300, ElementType (nan));
+    REQUIRE (std::isnan (vctr::l2Norm << filter << nans));
+
+    for (size_t i : { size_t (0), size_t (150), size_t (299) })
+    {
+        vctr::Vector zerosAndNaN = zeros;
+        zerosAndNaN[i] = ElementType (nan);
+        REQUIRE (std::isnan (vctr::l2Norm << filter << zerosAndNaN));
+
+        vctr::Vector infAndNaN = zerosAndNaN;
+        infAndNaN[(i + 1) % 300] = ElementType (inf);
+        REQUIRE (std::isnan (vctr::l2Norm << filter << infAndNaN));
+    }
+
+    vctr::Vector zerosAndInf = zeros;
+    zerosAndInf[7] = ElementType (-inf);
+    REQUIRE ((vctr::l2Norm << filter << zerosAndInf) == inf);
+}
+
+TEST_CASE ("Norms constexpr", "[norm]")
+{
+    constexpr vctr::Array src { 3.0, -4.0 };
+
+    static_assert ((vctr::l1Norm << src) == 7.0);
+    static_assert ((vctr::lInfNorm << src) == 4.0);
+}
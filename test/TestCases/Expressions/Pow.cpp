@@ -65,10 +65,17 @@ TEMPLATE_PRODUCT_TEST_CASE ("Pow", "[pow]", (PlatformVectorOps, VCTR_NATIVE_SIMD
         REQUIRE_THAT (p, vctr::EqualsTransformedBy<powerConstantExp<singleExponent>> (srcA).withEpsilon (0.00001));
     }
 
+    // The SIMD pow kernels for real floating point values might deviate from std::pow by a few ulp
+    [[maybe_unused]] const auto kernelEpsilon = double (std::numeric_limits<vctr::RealType<ElementType>>::epsilon()) * 4.0;
+
     SECTION ("Single value raised to the power of Vector")
     {
         const vctr::Vector p = filter << vctr::pow (ElementType (3), srcA);
-        REQUIRE_THAT (p, vctr::EqualsTransformedBy<powerConstantBase<3>> (srcA));
+
+        if constexpr (vctr::is::realFloatNumber<ElementType>)
+            REQUIRE_THAT (p, vctr::EqualsTransformedBy<powerConstantBase<3>> (srcA).withEpsilon (kernelEpsilon));
+        else
+            REQUIRE_THAT (p, vctr::EqualsTransformedBy<powerConstantBase<3>> (srcA));
     }
 
     SECTION ("Vector raised to the power of a compile time constant value")
@@ -77,9 +84,33 @@ TEMPLATE_PRODUCT_TEST_CASE ("Pow", "[pow]", (PlatformVectorOps, VCTR_NATIVE_SIMD
         REQUIRE_THAT (p, vctr::EqualsTransformedBy<powerConstantExp<singleExponent>> (srcA).withEpsilon (0.00001));
     }
 
+    SECTION ("Integral values raised to the power of a compile time constant value")
+    {
+        // All powers of integral values in [-15, 15] up to 15^5 are exactly representable, so the multiplication chain
+        // has to compute them without any rounding error
+        if constexpr (vctr::is::realFloatNumber<ElementType>)
+        {
+            vctr::Vector<ElementType> integralValues (31);
+            for (size_t i = 0; i < integralValues.size(); ++i)
+                integralValues[i] = ElementType (int (i) - 15);
+
+            const vctr::Vector p = filter << vctr::powConstantExponent<5> << integralValues;
+
+            for (size_t i = 0; i < integralValues.size(); ++i)
+            {
+                const auto x = int64_t (integralValues[i]);
+                REQUIRE (p[i] == ElementType (x * x * x * x * x));
+            }
+        }
+    }
+
     SECTION ("Compile time constant value raised to the power of Vector")
     {
         const vctr::Vector p = filter << vctr::powConstantBase<4> << srcA;
-        REQUIRE_THAT (p, vctr::EqualsTransformedBy<powerConstantBase<4>> (srcA));
+
+        if constexpr (vctr::is::realFloatNumber<ElementType>)
+            REQUIRE_THAT (p, vctr::EqualsTransformedBy<powerConstantBase<4>> (srcA).withEpsilon (kernelEpsilon));
+        else
+            REQUIRE_THAT (p, vctr::EqualsTransformedBy<powerConstantBase<4>> (srcA));
     }
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <vctr::is::realNumber T>
+T reciprocal (T x) { return T (1) / x; }
+
+template <vctr::is::realNumber T>
+T rsqrt (T x) { return T (1) / std::sqrt (x); }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Reciprocal", "[reciprocal]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_NO_ZEROS (10)
+
+    const vctr::Vector r = filter << vctr::reciprocal << srcA;
+    const vctr::Vector f = filter << vctr::fastReciprocal << srcA;
+
+    REQUIRE_THAT (r, vctr::EqualsTransformedBy<reciprocal> (srcA).withEpsilon (0.000001));
+    REQUIRE_THAT (f, vctr::EqualsTransformedBy<reciprocal> (srcA).withEpsilon (0.000001));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Reciprocal Square Root", "[rsqrt]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_NO_ZEROS_IN_RANGE (1, 10000, 10)
+
+    const vctr::Vector r = filter << vctr::rsqrt << srcA;
+    const vctr::Vector f = filter << vctr::fastRsqrt << srcA;
+
+    REQUIRE_THAT (r, vctr::EqualsTransformedBy<rsqrt> (srcA).withEpsilon (0.000001));
+    REQUIRE_THAT (f, vctr::EqualsTransformedBy<rsqrt> (srcA).withEpsilon (0.000001));
+
+    if constexpr (std::is_same_v<ElementType, float>)
+    {
+        // Subnormal inputs are flushed to zero, regardless of the position in the vector and the SIMD path taken
+        vctr::Vector<float> subnormals (37, std::numeric_limits<float>::min() / 3.0f);
+        subnormals[0] = std::numeric_limits<float>::denorm_min();
+        subnormals[36] = std::numeric_limits<float>::denorm_min();
+
+        const vctr::Vector fs = filter << vctr::fastRsqrt << subnormals;
+        REQUIRE_THAT (fs, vctr::AllElementsEqualTo (std::numeric_limits<float>::infinity()));
+    }
+}
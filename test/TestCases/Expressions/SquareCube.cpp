@@ -43,6 +43,15 @@ TEMPLATE_PRODUCT_TEST_CASE ("Square Root", "[sqrt]", (PlatformVectorOps, VCTR_NA
     REQUIRE_THAT (s, vctr::EqualsTransformedBy<sqrt> (srcA).withEpsilon (0.000001));
 }
 
+TEMPLATE_PRODUCT_TEST_CASE ("Fast Square Root", "[sqrt]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_IN_RANGE (0, 10000, 10)
+
+    const vctr::Vector s = filter << vctr::fastSqrt << srcA;
+
+    REQUIRE_THAT (s, vctr::EqualsTransformedBy<sqrt> (srcA).withEpsilon (0.000001));
+}
+
 TEMPLATE_PRODUCT_TEST_CASE ("Square", "[square]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, uint32_t, int64_t, uint64_t, std::complex<float>, std::complex<double>) )
 {
     VCTR_TEST_DEFINES_IN_RANGE (-20, 20, 10)
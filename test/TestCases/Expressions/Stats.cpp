@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_PRODUCT_TEST_CASE ("Stats", "[stats]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    const auto eps = ElementType (0.0001);
+
+    // All statistics are computed in a single pass, the remaining elements of sizes that are no multiple of the
+    // register size are reduced element wise
+    for (size_t n : { 1, 7, 17, 33, 44, 299 })
+    {
+        const auto src = srcC.subSpan (1, n);
+
+        const vctr::Statistics<ElementType> stats = vctr::stats << filter << src;
+
+        REQUIRE (stats.min == src.min());
+        REQUIRE (stats.max == src.max());
+        REQUIRE (stats.minAbs == src.minAbs());
+        REQUIRE (stats.maxAbs == src.maxAbs());
+        REQUIRE_THAT (stats.mean, Catch::Matchers::WithinAbs (src.mean(), eps * ElementType (100)));
+        REQUIRE_THAT (stats.meanSquare, Catch::Matchers::WithinRel (src.meanSquare(), eps));
+        REQUIRE_THAT (stats.rms, Catch::Matchers::WithinRel (src.rms(), eps));
+    }
+
+    constexpr auto statsA = vctr::stats << srcA;
+    static_assert (statsA.min == srcA.min());
+    static_assert (statsA.max == srcA.max());
+}
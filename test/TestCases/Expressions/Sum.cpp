@@ -58,6 +58,32 @@ TEMPLATE_PRODUCT_TEST_CASE ("Sum", "[sum]", (PlatformVectorOps, VCTR_NATIVE_SIMD
     }
 }
 
+TEMPLATE_PRODUCT_TEST_CASE ("Sum of large vectors", "[sum]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, uint32_t) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    // Large enough to be reduced by the unrolled loop with independent accumulators, followed by single registers
+    const auto sum = vctr::sum << filter << srcC;
+    const auto sumU = vctr::sum << filter << srcUnaligned;
+
+    const auto ref = std::reduce (srcC.begin(), srcC.end());
+    const auto refU = std::reduce (srcUnaligned.begin(), srcUnaligned.end());
+
+    if constexpr (vctr::is::realFloatNumber<ElementType>)
+    {
+        // The sum of values in the range -100 to 100 might be close to zero, so we check the absolute error here
+        const auto eps = 0.01;
+
+        REQUIRE_THAT (sum, Catch::Matchers::WithinAbs (ref, eps));
+        REQUIRE_THAT (sumU, Catch::Matchers::WithinAbs (refU, eps));
+    }
+    else
+    {
+        REQUIRE (sum == ref);
+        REQUIRE (sumU == refU);
+    }
+}
+
 TEST_CASE ("Sum strings", "[sum]")
 {
     const auto loremIpsum = UnitTestValues<std::string>::template array<10, 0>();
@@ -65,4 +91,30 @@ TEST_CASE ("Sum strings", "[sum]")
     const auto sum = vctr::sum << loremIpsum;
 
     REQUIRE (sum == std::reduce (loremIpsum.begin(), loremIpsum.end()));
-}
\ No newline at end of file
+}
+TEMPLATE_TEST_CASE ("Sum on multiple threads", "[sum]", float, double, int32_t)
+{
+    vctr::ThreadPool singleThread (1);
+    vctr::ThreadPool threeThreads (3);
+    vctr::ThreadPool eightThreads (8);
+
+    // Sizes below the minimum number of elements for a parallel reduction, with a remainder of chunk sizes that are
+    // not a multiple of the register size and with a tail that is smaller than a register.
+    for (size_t n : { size_t (1000), size_t (1) << 18, (size_t (1) << 20) + 13 })
+    {
+        vctr::Vector<TestType> src (n);
+
+        for (size_t i = 0; i < n; ++i)
+            src[i] = TestType (int (i % 201) - 100) / TestType (4);
+
+        const auto sum = vctr::sum.reduceParallel (src, singleThread);
+
+        // The chunks and the combination of their partial sums don't depend on the number of threads
+        REQUIRE (vctr::sum.reduceParallel (src, threeThreads) == sum);
+        REQUIRE (vctr::sum.reduceParallel (src, eightThreads) == sum);
+
+        // Quarters of small integers are summed up exactly
+        REQUIRE (sum == std::reduce (src.begin(), src.end()));
+        REQUIRE (vctr::mean.reduceParallel (src * TestType (2), eightThreads) == vctr::mean << src * TestType (2));
+    }
+}
@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_PRODUCT_TEST_CASE ("Compensated sum", "[sum][compensated]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double) )
+{
+    VCTR_TEST_DEFINES (10)
+
+    // A large first value swallows the following small ones in a plain sum of floats
+    for (size_t n : { 7, 64, 1000 })
+    {
+        vctr::Vector<ElementType> src (n, ElementType (1));
+        src[0] = ElementType (1 << 25);
+
+        const auto sum = vctr::sumCompensated << filter << src;
+        const auto ref = ElementType (double (1 << 25) + double (n - 1));
+
+        REQUIRE (sum == ref);
+    }
+
+    constexpr auto cancellation = vctr::sumCompensated << vctr::Array { ElementType (1), ElementType (1e8), ElementType (1), ElementType (-1e8) };
+    static_assert (cancellation == ElementType (2));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Compensated mean and mean square", "[mean][compensated]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double) )
+{
+    VCTR_TEST_DEFINES (300)
+
+    double sum = 0.0;
+    double squaredSum = 0.0;
+
+    for (auto x : srcC)
+    {
+        sum += double (x);
+        squaredSum += double (x) * double (x);
+    }
+
+    const auto mean = vctr::meanCompensated << filter << srcC;
+    const auto meanSquare = vctr::meanSquareCompensated << filter << srcC;
+
+    // The mean of values in the range -100 to 100 might be close to zero, so we check the absolute error here
+    REQUIRE_THAT (mean, Catch::Matchers::WithinAbs (sum / 300.0, 1e-5));
+    REQUIRE_THAT (meanSquare, Catch::Matchers::WithinRel (ElementType (squaredSum / 300.0), ElementType (1e-6)));
+}
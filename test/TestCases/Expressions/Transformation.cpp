@@ -43,6 +43,47 @@ TEMPLATE_PRODUCT_TEST_CASE ("TransformedByStaticCast", "[transformation]", (Plat
     REQUIRE_THAT (castedToDouble, vctr::EqualsTransformedBy<toDoublePlus1> (srcA));
 }
 
+TEMPLATE_TEST_CASE ("TransformedByStaticCast with 16 bit floats", "[transformation]", vctr::float16, vctr::bfloat16)
+{
+    // 37 elements are converted by SIMD registers and a scalar tail
+    auto values = UnitTestValues<float>::template vector<37, 0, -1000, 1000>();
+    values[0] = std::numeric_limits<float>::infinity();
+    values[1] = 1.0e6f;
+    values[2] = -0.0f;
+
+    const vctr::Vector<TestType> converted = vctr::transformedByStaticCastTo<TestType> << values;
+    const vctr::Vector<float> convertedBack = vctr::transformedByStaticCastTo<float> << converted;
+    const vctr::Vector<float> doubled = (vctr::transformedByStaticCastTo<float> << converted) * 2.0f;
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        REQUIRE (converted[i].toBits() == TestType (values[i]).toBits());
+        REQUIRE (convertedBack[i] == float (converted[i]));
+        REQUIRE (doubled[i] == 2.0f * converted[i]);
+
+        // The conversion rounds to the nearest value, which differs by less than half the precision of the type
+        if (std::isfinite (convertedBack[i]))
+            REQUIRE_THAT (convertedBack[i], Catch::Matchers::WithinRel (values[i], std::same_as<TestType, vctr::float16> ? 0.0005f : 0.004f));
+    }
+
+    // float16 values above 65504 are rounded to infinity and ties are rounded to the even value
+    if constexpr (std::same_as<TestType, vctr::float16>)
+    {
+        REQUIRE (std::isinf (convertedBack[1]));
+        REQUIRE (vctr::float16 (1.0f + 0x1p-11f).toBits() == 0x3c00);
+        REQUIRE (vctr::float16 (1.0f + 0x1.8p-10f).toBits() == 0x3c02);
+        REQUIRE (float (vctr::float16::fromBits (0x0001)) == 0x1p-24f);
+    }
+    else
+    {
+        REQUIRE (convertedBack[1] == 999424.0f);
+        REQUIRE (vctr::bfloat16 (1.0f + 0x1p-8f).toBits() == 0x3f80);
+        REQUIRE (vctr::bfloat16 (1.0f + 0x1.8p-7f).toBits() == 0x3f82);
+    }
+
+    REQUIRE (std::signbit (convertedBack[2]));
+}
+
 TEMPLATE_PRODUCT_TEST_CASE ("TransformedBy", "[transformation]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, int64_t))
 {
     VCTR_TEST_DEFINES (10)
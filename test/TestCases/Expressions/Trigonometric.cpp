@@ -92,6 +92,67 @@ TEMPLATE_PRODUCT_TEST_CASE ("Tan", "[expressions][trigonometric]", (PlatformVect
     REQUIRE_THAT (resU, vctr::EqualsTransformedBy<tan> (srcUnaligned).withMargin (0.0001));
 }
 
+TEMPLATE_PRODUCT_TEST_CASE ("SinCos", "[expressions][trigonometric]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    using ElementType = typename TestType::ElementType;
+    const auto& filter = TestType::filter;
+
+    const auto src = UnitTestValues<ElementType>::template vector<10, 0, -4, 4> (false, false);
+    const vctr::Span srcUnaligned = src.template subSpan<1>();
+
+    vctr::Vector<ElementType> s (10), c (10);
+    vctr::Vector<ElementType> sU (9), cU (9);
+
+    vctr::sinCos (filter << src, s, c);
+    vctr::sinCos (filter << srcUnaligned, sU, cU);
+
+    REQUIRE_THAT (s, vctr::EqualsTransformedBy<sin> (src).withMargin (0.0001));
+    REQUIRE_THAT (c, vctr::EqualsTransformedBy<cos> (src).withMargin (0.0001));
+    REQUIRE_THAT (sU, vctr::EqualsTransformedBy<sin> (srcUnaligned).withMargin (0.0001));
+    REQUIRE_THAT (cU, vctr::EqualsTransformedBy<cos> (srcUnaligned).withMargin (0.0001));
+
+    const vctr::Vector<ElementType> srcScaled = src * ElementType (2);
+    vctr::sinCos (filter << src * ElementType (2), s, c);
+
+    REQUIRE_THAT (s, vctr::EqualsTransformedBy<sin> (srcScaled).withMargin (0.0001));
+    REQUIRE_THAT (c, vctr::EqualsTransformedBy<cos> (srcScaled).withMargin (0.0001));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("SinCos, Sin, Cos and Tan of odd sizes and special values", "[expressions][trigonometric]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    using ElementType = typename TestType::ElementType;
+    using Limits = std::numeric_limits<ElementType>;
+
+    const auto& filter = TestType::filter;
+
+    // Sizes below, between and above multiples of the register sizes, so that the overlapping tail of every instruction
+    // set is taken. Large arguments, inf and NaN are placed at the start, in the middle and at the end of the values.
+    for (size_t size : { 1, 3, 7, 13, 21, 37, 64, 101 })
+    {
+        vctr::Vector<ElementType> src (size, [] (size_t i) { return ElementType (i) * ElementType (0.77) - ElementType (30); });
+
+        const std::array<ElementType, 7> specialValues { ElementType (1e20), -ElementType (1e20), Limits::infinity(), -Limits::infinity(), Limits::quiet_NaN(), ElementType (0), -ElementType (0) };
+
+        for (size_t i = 0; i < specialValues.size(); ++i)
+            src[(i * 29) % size] = specialValues[i];
+
+        src.back() = specialValues[size % specialValues.size()];
+
+        vctr::Vector<ElementType> s (size), c (size);
+        vctr::sinCos (filter << src, s, c);
+
+        const vctr::Vector sinResult = filter << vctr::sin << src;
+        const vctr::Vector cosResult = filter << vctr::cos << src;
+        const vctr::Vector tanResult = filter << vctr::tan << src;
+
+        requireSameResultsAsStdLib (s, src, [] (ElementType x) { return std::sin (x); }, 3);
+        requireSameResultsAsStdLib (c, src, [] (ElementType x) { return std::cos (x); }, 3);
+        requireSameResultsAsStdLib (sinResult, src, [] (ElementType x) { return std::sin (x); }, 3);
+        requireSameResultsAsStdLib (cosResult, src, [] (ElementType x) { return std::cos (x); }, 3);
+        requireSameResultsAsStdLib (tanResult, src, [] (ElementType x) { return std::tan (x); }, 4);
+    }
+}
+
 TEMPLATE_PRODUCT_TEST_CASE ("Sinh", "[expressions][trigonometric]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, std::complex<float>, std::complex<double>))
 {
     VCTR_TEST_DEFINES_IN_RANGE (-4, 4, 10)
@@ -381,6 +381,108 @@ TEST_CASE ("sort", "[VctrBaseMemberFunctions]")
     REQUIRE (characters == "/AccD");
 }
 
+TEMPLATE_TEST_CASE ("sort arithmetic types", "[VctrBaseMemberFunctions]", float, double, int32_t, uint32_t)
+{
+    // Small sizes are sorted by sorting networks, larger ones are partitioned first. The small value range leads to a lot
+    // of equal elements.
+    const auto values = UnitTestValues<TestType>::template vector<100, 0, 0, 20>();
+
+    for (size_t n : { 0, 1, 7, 16, 33, 64, 100, 500, 2000 })
+    {
+        vctr::Vector<TestType> v (n, [&] (size_t i) { return values[(i * 7) % values.size()]; });
+
+        auto expected = v;
+        std::sort (expected.begin(), expected.end());
+
+        v.sort();
+        REQUIRE_THAT (v, vctr::Equals (expected));
+    }
+}
+
+TEMPLATE_TEST_CASE ("sort random values", "[VctrBaseMemberFunctions]", float, double, int32_t, uint32_t)
+{
+    // Covers every sorting network size and the partitioning above it with values spanning most of the type's range.
+    // The test target is built without -march flags, so this runs the runtime dispatched AVX512 or AVX2 paths.
+    for (size_t n = 1; n <= 5000; n += n < 600 ? 1 : 37)
+    {
+        auto v = randomTestValues<TestType> (n, uint32_t (n));
+
+        auto expected = v;
+        std::sort (expected.begin(), expected.end());
+
+        v.sort();
+        REQUIRE_THAT (v, vctr::Equals (expected));
+    }
+}
+
+TEMPLATE_TEST_CASE ("sort with NaN", "[VctrBaseMemberFunctions]", float, double)
+{
+    const auto nan = std::numeric_limits<TestType>::quiet_NaN();
+    const auto inf = std::numeric_limits<TestType>::infinity();
+
+    // NaNs are moved behind all other values
+    vctr::Vector<TestType> v { 3, nan, -inf, 0, nan, inf, -1 };
+    v.sort();
+
+    REQUIRE_THAT (v.subSpan (0, 5), vctr::Equals ({ -inf, TestType (-1), TestType (0), TestType (3), inf }));
+    REQUIRE (std::isnan (v[5]));
+    REQUIRE (std::isnan (v[6]));
+}
+
+TEMPLATE_TEST_CASE ("nthElement and partialSort", "[VctrBaseMemberFunctions]", float, double, int32_t, uint32_t, int64_t)
+{
+    const auto values = UnitTestValues<TestType>::template vector<100, 0, 0, 20>();
+
+    for (size_t n : { 1, 7, 33, 100, 500, 2000 })
+    {
+        const vctr::Vector<TestType> v (n, [&] (size_t i) { return values[(i * 7) % values.size()]; });
+
+        auto sorted = v;
+        std::sort (sorted.begin(), sorted.end());
+
+        for (size_t k : { size_t (0), n / 3, n - 1 })
+        {
+            auto selected = v;
+            selected.nthElement (k);
+
+            REQUIRE (selected[k] == sorted[k]);
+            REQUIRE (selected.subSpan (0, k).all ([&] (TestType x) { return x <= sorted[k]; }));
+            REQUIRE (selected.subSpan (k).all ([&] (TestType x) { return x >= sorted[k]; }));
+
+            auto partiallySorted = v;
+            partiallySorted.partialSort (k);
+
+            REQUIRE_THAT (partiallySorted.subSpan (0, k), vctr::Equals (sorted.subSpan (0, k)));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE ("nthElement and partialSort random values", "[VctrBaseMemberFunctions]", float, double, int32_t, uint32_t)
+{
+    for (size_t n : { 100, 255, 1000, 4999, 20000 })
+    {
+        const auto v = randomTestValues<TestType> (n, uint32_t (n));
+
+        auto sorted = v;
+        std::sort (sorted.begin(), sorted.end());
+
+        for (size_t k : { size_t (0), size_t (1), n / 2, n - 7, n - 1 })
+        {
+            auto selected = v;
+            selected.nthElement (k);
+
+            REQUIRE (selected[k] == sorted[k]);
+            REQUIRE (selected.subSpan (0, k).all ([&] (TestType x) { return x <= sorted[k]; }));
+            REQUIRE (selected.subSpan (k).all ([&] (TestType x) { return x >= sorted[k]; }));
+
+            auto partiallySorted = v;
+            partiallySorted.partialSort (k);
+
+            REQUIRE_THAT (partiallySorted.subSpan (0, k), vctr::Equals (sorted.subSpan (0, k)));
+        }
+    }
+}
+
 TEST_CASE ("min and max element", "[VctrBaseMemberFunctions]")
 {
     const vctr::Array values { 2, 0, -4, 10, -4 };
@@ -389,6 +491,12 @@ TEST_CASE ("min and max element", "[VctrBaseMemberFunctions]")
     REQUIRE (values.indexOfMinElement() == 2);
     REQUIRE (*values.findMaxElement() == 10);
     REQUIRE (values.indexOfMaxElement() == 3);
+
+    // Like the distance to the end iterator, which findMinElement and findMaxElement return for empty containers
+    const vctr::Vector<float> empty;
+
+    REQUIRE (empty.indexOfMinElement() == 0);
+    REQUIRE (empty.indexOfMaxElement() == 0);
 }
 
 TEST_CASE ("firstValueGreaterThan", "[VctrBaseMemberFunctions]")
@@ -494,6 +602,39 @@ TEMPLATE_TEST_CASE ("anyElementIsNaN", "[VctrBaseMemberFunctions]", float, doubl
     REQUIRE (cplx.anyElementIsNaN());
 }
 
+TEMPLATE_TEST_CASE ("assignParallel", "[VctrBaseMemberFunctions]", float, double, int32_t)
+{
+    vctr::ThreadPool pool (4);
+
+    for (size_t n : { size_t (0), size_t (17), size_t (1) << 18, (size_t (1) << 18) + 13 })
+    {
+        vctr::Vector<TestType> a (n);
+        vctr::Vector<TestType> b (n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            a[i] = TestType (i % 101);
+            b[i] = TestType (int (i % 13) - 6);
+        }
+
+        const vctr::Vector<TestType> expected = a * b + a * TestType (3);
+
+        vctr::Vector<TestType> v;
+        v.assignParallel (a * b + a * TestType (3), pool);
+        REQUIRE_THAT (v, vctr::Equals (expected));
+
+        // Unaligned destination
+        vctr::Vector<TestType> storage (n + 1);
+        vctr::Span<TestType> s (storage.data() + 1, n);
+        s.assignParallel (a * b + a * TestType (3), pool);
+        REQUIRE (s == expected);
+
+        // In place evaluation
+        a.assignParallel (a * b + a * TestType (3), pool);
+        REQUIRE_THAT (a, vctr::Equals (expected));
+    }
+}
+
 TEMPLATE_TEST_CASE ("operator==", "[VctrBaseFreeFunctions]", float, uint64_t, std::string)
 {
     auto a = UnitTestValues<TestType>::template array<100, 0>();
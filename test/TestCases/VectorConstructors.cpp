@@ -106,6 +106,32 @@ TEST_CASE ("Vector Constructor with initializer function", "[Vector][Constructor
     REQUIRE_THAT (s[2], Catch::Matchers::Equals ("2"));
 }
 
+TEMPLATE_TEST_CASE ("Vector Constructor with ThreadPool", "[Vector][Constructor]", float, int64_t)
+{
+    vctr::ThreadPool pool (4);
+
+    const vctr::Vector<TestType> small (100, pool);
+    REQUIRE (small.size() == 100);
+    REQUIRE_THAT (small, vctr::AllElementsEqualTo (TestType (0)));
+
+    vctr::Vector<TestType, vctr::NumaLocalVectorAllocator> large (100003, pool);
+    REQUIRE (large.size() == 100003);
+    REQUIRE_THAT (large, vctr::AllElementsEqualTo (TestType (0)));
+
+    large.fill (TestType (1));
+    large.resize (200001, pool);
+    REQUIRE (large.size() == 200001);
+    REQUIRE_THAT (large.subSpan (0, 100003), vctr::AllElementsEqualTo (TestType (1)));
+    REQUIRE_THAT (large.subSpan (100003), vctr::AllElementsEqualTo (TestType (0)));
+
+    large.resize (42, pool);
+    REQUIRE (large.size() == 42);
+    REQUIRE_THAT (large, vctr::AllElementsEqualTo (TestType (1)));
+
+    // Allocators that value initialise new elements would do so on the calling thread
+    static_assert (! std::is_constructible_v<vctr::Vector<TestType, std::allocator>, size_t, vctr::ThreadPool&>);
+}
+
 TEST_CASE ("OwnedVector Constructors", "[Vector][OwnedVector][Constructor]")
 {
     auto* i1 = new int32_t (1);
@@ -134,6 +134,41 @@ TEST_CASE ("capacity, shrink_to_fit, reserve, clear", "[VectorMemberFunctions]")
     */
 }
 
+TEST_CASE ("resize, resizeUninitialized", "[VectorMemberFunctions]")
+{
+    vctr::Vector<float> v (10, 1.0f);
+
+    v.resize (20);
+    REQUIRE (v.size() == 20);
+    REQUIRE_THAT (v.subSpan (0, 10), vctr::AllElementsEqualTo (1.0f));
+    REQUIRE_THAT (v.subSpan (10), vctr::AllElementsEqualTo (0.0f));
+
+    v.emplace_back();
+    REQUIRE (v.size() == 21);
+    REQUIRE (v.back() == 0.0f);
+
+    v.resizeUninitialized (1000);
+    REQUIRE (v.size() == 1000);
+    REQUIRE_THAT (v.subSpan (0, 10), vctr::AllElementsEqualTo (1.0f));
+
+    v.fill (2.0f);
+    vctr::Vector<float> u (1000, vctr::uninitialized);
+    REQUIRE (u.size() == 1000);
+
+    u = v + 1.0f;
+    REQUIRE_THAT (u, vctr::AllElementsEqualTo (3.0f));
+
+    v.resizeUninitialized (5);
+    REQUIRE (v.size() == 5);
+    REQUIRE_THAT (v, vctr::AllElementsEqualTo (2.0f));
+
+    // Only resizeUninitialized leaves elements uninitialised, the underlying std::vector keeps value initialising them
+    static_assert (std::same_as<std::vector<float, vctr::AlignedAllocator<float, vctr::Config::maxSIMDRegisterSize>>, std::remove_cvref_t<decltype (v.getUnderlyingVector())>>);
+    v.getUnderlyingVector().resize (1000);
+    REQUIRE_THAT (v.subSpan (0, 5), vctr::AllElementsEqualTo (2.0f));
+    REQUIRE_THAT (v.subSpan (5), vctr::AllElementsEqualTo (0.0f));
+}
+
 TEST_CASE ("erase", "[VectorMemberFunctions]")
 {
     vctr::Vector v { 0, 1, 2, 3, 4, 5, 1, 2, 3, 4, 5 };
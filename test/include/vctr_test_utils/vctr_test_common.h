@@ -24,6 +24,7 @@
 
 #include <vctr_utils/compile_time_random_array.h>
 #include <vctr/vctr.h>
+#include <random>
 
 /** A helper class to generate compile time generated arrays pre-populated with random values */
 template <class T>
@@ -145,6 +146,26 @@ public:
     }
 };
 
+/** Returns a Vector of n random values spanning most of the value range of T, generated at runtime. Use this instead of
+    UnitTestValues for sizes that would be too costly to generate at compile time.
+ */
+template <class T>
+vctr::Vector<T> randomTestValues (size_t n, uint32_t seed)
+{
+    std::mt19937 rng (seed);
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist (T (-1e6), T (1e6));
+        return vctr::Vector<T> (n, [&] (size_t) { return dist (rng); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist (std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+        return vctr::Vector<T> (n, [&] (size_t) { return dist (rng); });
+    }
+}
+
 template <class T>
 struct PlatformVectorOps
 {
@@ -159,6 +180,13 @@ struct AVX
     using ElementType = T;
 };
 
+template <class T>
+struct AVX512
+{
+    static constexpr auto filter = vctr::useAVX512;
+    using ElementType = T;
+};
+
 template <class T>
 struct SSE
 {
@@ -176,7 +204,7 @@ struct Neon
 #if VCTR_ARM
 #define VCTR_NATIVE_SIMD Neon
 #else
-#define VCTR_NATIVE_SIMD AVX, SSE
+#define VCTR_NATIVE_SIMD AVX512, AVX, SSE
 #endif
 
 #define VCTR_TEST_DEFINES_BASE(testVectorSize, start, end, avoidZeros, forceZero)                                                              \
@@ -218,3 +246,25 @@ struct Neon
 #include <vctr_test_utils/vctr_catch_matchers.h>
 #include <catch2/matchers/catch_matchers_all.hpp>
 #include <catch2/catch_template_test_macros.hpp>
+
+/** Requires each element in results to match fn applied to the corresponding element in src, including the handling
+    of special values by the standard library. NaN results only need to be NaN, infinite and zero results have to match
+    exactly and all other results might deviate by maxUlpDiff.
+ */
+template <vctr::is::realFloatNumber T, class Fn>
+void requireSameResultsAsStdLib (const vctr::Vector<T>& results, const vctr::Vector<T>& src, Fn&& fn, uint64_t maxUlpDiff)
+{
+    REQUIRE (results.size() == src.size());
+
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        const T expected = fn (src[i]);
+
+        if (std::isnan (expected))
+            REQUIRE (std::isnan (results[i]));
+        else if (std::isinf (expected) || expected == T (0))
+            REQUIRE (results[i] == expected);
+        else
+            REQUIRE_THAT (results[i], Catch::Matchers::WithinULP (expected, maxUlpDiff));
+    }
+}